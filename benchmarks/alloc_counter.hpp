@@ -0,0 +1,46 @@
+// Stefan Olivier
+// Description: Global allocation counter shared by the benchmark executables
+
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace vtm::bench {
+
+inline std::atomic<std::size_t> allocation_count{0};
+inline std::atomic<std::size_t> allocation_bytes{0};
+
+struct allocation_scope
+{
+    std::size_t count = allocation_count.load();
+    std::size_t bytes = allocation_bytes.load();
+
+    auto allocations() const -> std::size_t { return allocation_count.load() - count; }
+    auto allocated_bytes() const -> std::size_t { return allocation_bytes.load() - bytes; }
+};
+
+} // @END OF namespace vtm::bench
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Replaceable global allocation functions, include from exactly one translation unit
+void* operator new(std::size_t size)
+{
+    vtm::bench::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    vtm::bench::allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,92 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "edlcache.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+// Pro Tools style session of tracks x events, timecodes at 25 fps
+auto make_session(const int tracks, const int events) -> std::string
+{
+    std::string text;
+    text += "SESSION NAME:\tBenchmark\nSAMPLE RATE:\t48000.000000\nBIT DEPTH:\t24-bit\n";
+    text += "SESSION START TIMECODE:\t01:00:00:00\nTIMECODE FORMAT:\t25 Frame\n";
+    text += fmt::format("# OF AUDIO TRACKS:\t{}\n\n\nT R A C K  L I S T I N G\n", tracks);
+
+    for (int t = 0; t < tracks; ++t) {
+        text += fmt::format("TRACK NAME:\tTrack {}\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n", t);
+        text += "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+        for (int e = 0; e < events; ++e) {
+            const int start = 90000 + e * 100;
+            const auto tc = [](const int frames) {
+                return fmt::format("{:02}:{:02}:{:02}:{:02}", frames / 90000, frames / 1500 % 60, frames / 25 % 60, frames % 25);
+            };
+            text += fmt::format("1       \t{:<8}\tclip_{}_{:<20}\t{}   \t{}   \t{}   \tUnmuted\n", e + 1, t, e, tc(start), tc(start + 50), tc(50));
+        }
+        text += "\n\n";
+    }
+
+    return text;
+}
+
+} // namespace
+
+TEST_CASE("vtm::avidpt_edl_cache Warm Open", "[EDL File][cache][benchmark]")
+{
+    // 1000 tracks x 200 events, about 20 MB of text
+    const auto path = (std::filesystem::temp_directory_path() / "vtm_edlcache_bench.txt").string();
+    const auto dir = (std::filesystem::temp_directory_path() / "vtm_edlcache_bench").string();
+    {
+        const std::string text = make_session(1000, 200);
+        std::ofstream(path, std::ios::binary) << text;
+        fmt::print("session size: {:.1f} MB\n", double(text.size()) / 1e6);
+    }
+
+    std::filesystem::remove_all(dir);
+    const auto cache = vtm::edl::open_cached(path, dir);
+    fmt::print("cache size: {:.1f} MB\n", double(std::filesystem::file_size(vtm::edl::internal::avidpt_cache_path(path, dir))) / 1e6);
+
+    BENCHMARK("avidpt_edl full parse")
+    {
+        vtm::avidpt_edl edl;
+        edl.parse_file(path);
+        return edl.tracks().size();
+    };
+
+    BENCHMARK("avidpt_edl_view full parse")
+    {
+        vtm::avidpt_edl_view edl;
+        edl.parse_file(path);
+        return edl.tracks().size();
+    };
+
+    BENCHMARK("open_cached, warm")
+    {
+        return vtm::edl::open_cached(path, dir).event_count();
+    };
+
+    BENCHMARK("open_cached, warm, verify content hash")
+    {
+        vtm::avidpt_edl_cache warm;
+        warm.open(vtm::edl::internal::avidpt_cache_path(path, dir), vtm::edl::internal::avidpt_absolute_path(path), true);
+        return warm.event_count();
+    };
+
+    BENCHMARK("open_cached, warm + sum of every duration")
+    {
+        const auto warm = vtm::edl::open_cached(path, dir);
+        std::int64_t total = 0;
+        for (const std::int64_t units : warm.duration_units()) total += units;
+        return total;
+    };
+
+    BENCHMARK("open_cached, cold (parse + store)")
+    {
+        std::filesystem::remove_all(dir);
+        return vtm::edl::open_cached(path, dir).event_count();
+    };
+}
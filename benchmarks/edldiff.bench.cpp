@@ -0,0 +1,79 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "edldiff.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+// tracks x events at 25 fps. The edited cut moves every 7th clip, trims every
+// 11th, renames every 13th and drops every 17th
+auto make_session(const int tracks, const int events, const bool edited) -> std::string
+{
+    const auto tc = [](const int frames) {
+        return fmt::format("{:02}:{:02}:{:02}:{:02}", frames / 90000, frames / 1500 % 60, frames / 25 % 60, frames % 25);
+    };
+
+    std::string text = "SESSION NAME:\tDiff\nSAMPLE RATE:\t48000.000000\nTIMECODE FORMAT:\t25 Frame\n\n\nT R A C K  L I S T I N G\n";
+    for (int t = 0; t < tracks; ++t) {
+        text += fmt::format("TRACK NAME:\tTrack {}\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n", t);
+        text += "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+        for (int e = 0; e < events; ++e) {
+            int start = 90000 + e * 100;
+            int end = start + 50;
+            std::string name = fmt::format("Reel1_Scene{:03}_Take{:02}", e / 4, e % 4);
+            if (edited) {
+                if (e % 17 == 0) continue;
+                if (e % 13 == 0) name += "_alt";
+                if (e % 11 == 0) end -= 5;
+                if (e % 7 == 0) { start += 25; end += 25; }
+            }
+            text += fmt::format("1       \t{:<8}\t{:<30}\t{}   \t{}   \t{}   \tUnmuted\n", e + 1, name, tc(start), tc(end), tc(end - start));
+        }
+        text += "\n\n";
+    }
+
+    return text;
+}
+
+} // namespace
+
+TEST_CASE("vtm::edl::diff Conform", "[EDL File][diff][benchmark]")
+{
+    // 500 tracks x 200 events, 100k events per side
+    const auto path_a = (std::filesystem::temp_directory_path() / "vtm_edldiff_bench_a.txt").string();
+    const auto path_b = (std::filesystem::temp_directory_path() / "vtm_edldiff_bench_b.txt").string();
+    std::ofstream(path_a, std::ios::binary) << make_session(500, 200, false);
+    std::ofstream(path_b, std::ios::binary) << make_session(500, 200, true);
+
+    vtm::avidpt_edl a;
+    vtm::avidpt_edl b;
+    a.parse_file(path_a);
+    b.parse_file(path_b);
+    vtm::avidpt_edl_columnar ca;
+    vtm::avidpt_edl_columnar cb;
+    ca.parse_file(path_a);
+    cb.parse_file(path_b);
+
+    const auto result = vtm::edl::diff(a, b);
+    fmt::print("unchanged: {}  moved: {}  trimmed: {}  inserted: {}  deleted: {}\n", result.unchanged,
+               result.count(vtm::edl::event_change_kind::moved), result.count(vtm::edl::event_change_kind::trimmed),
+               result.count(vtm::edl::event_change_kind::inserted), result.count(vtm::edl::event_change_kind::deleted));
+
+    BENCHMARK("vtm::edl::diff, 100k events")
+    {
+        return vtm::edl::diff(a, b).changes.size();
+    };
+
+    BENCHMARK("vtm::edl::diff, 100k columnar events")
+    {
+        return vtm::edl::diff(ca, cb).changes.size();
+    };
+
+    BENCHMARK("vtm::edl::diff, 100k events against itself")
+    {
+        return vtm::edl::diff(a, a).unchanged;
+    };
+}
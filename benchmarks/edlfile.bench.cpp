@@ -0,0 +1,332 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "edlfile.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Pro Tools style session of tracks x events, timecodes at 25 fps
+auto make_session(const int tracks, const int events) -> std::string
+{
+    std::string text;
+    text += "SESSION NAME:\tBenchmark\nSAMPLE RATE:\t48000.000000\nBIT DEPTH:\t24-bit\n";
+    text += "SESSION START TIMECODE:\t01:00:00:00\nTIMECODE FORMAT:\t25 Frame\n";
+    text += fmt::format("# OF AUDIO TRACKS:\t{}\n# OF AUDIO CLIPS:\t{}\n# OF AUDIO FILES:\t{}\n\n\n", tracks, tracks * events, tracks);
+    text += "T R A C K  L I S T I N G\n";
+
+    for (int t = 0; t < tracks; ++t) {
+        text += fmt::format("TRACK NAME:\tTrack {}\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n", t);
+        text += "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+        for (int e = 0; e < events; ++e) {
+            const int start = 90000 + e * 100;
+            const auto tc = [](const int frames) {
+                return fmt::format("{:02}:{:02}:{:02}:{:02}", frames / 90000, frames / 1500 % 60, frames / 25 % 60, frames % 25);
+            };
+            text += fmt::format("1       \t{:<8}\tclip_{}_{:<20}\t{}   \t{}   \t{}   \tUnmuted\n", e + 1, t, e, tc(start), tc(start + 50), tc(50));
+        }
+        text += "\n\n";
+    }
+
+    text += "M A R K E R S  L I S T I N G\n#   \tLOCATION     \tTIME REFERENCE    \tUNITS    \tNAME                             \tCOMMENTS\n";
+    for (int m = 0; m < 1000; ++m) {
+        text += fmt::format("{:<4}\t01:{:02}:{:02}:00  \t{:<17}\tSamples  \tMarker {:<25}\t\n", m + 1, m / 60 % 60, m % 60, m * 48000, m);
+    }
+
+    return text;
+}
+
+} // namespace
+
+TEST_CASE("vtm::avidpt_edl Parse Throughput", "[EDL File][parse][benchmark]")
+{
+    // 1000 tracks x 200 events, about 22 MB of text
+    const auto path = (std::filesystem::temp_directory_path() / "vtm_edlfile_bench.txt").string();
+    const std::string text = make_session(1000, 200);
+    std::ofstream(path, std::ios::binary) << text;
+    fmt::print("session size: {:.1f} MB\n", double(text.size()) / 1e6);
+
+    BENCHMARK("std::getline + field split (iostream baseline)")
+    {
+        std::ifstream in(path);
+        std::string line;
+        std::string field;
+        std::size_t fields = 0;
+        while (std::getline(in, line)) {
+            std::istringstream row(line);
+            while (std::getline(row, field, '\t')) ++fields;
+        }
+        return fields;
+    };
+
+    BENCHMARK("avidpt_edl parse_file (owning strings)")
+    {
+        vtm::avidpt_edl edl;
+        edl.parse_file(path);
+        return edl.data().tracks.size();
+    };
+
+    BENCHMARK("avidpt_edl_view parse_file (zero-copy strings)")
+    {
+        vtm::avidpt_edl_view edl;
+        edl.parse_file(path);
+        return edl.data().tracks.size();
+    };
+
+    // Time to the first usable answer, sections a job never reads are skipped
+    BENCHMARK("avidpt_edl parse_file + session header only")
+    {
+        vtm::avidpt_edl edl;
+        edl.parse_file(path);
+        return edl.session().audio_tracks;
+    };
+
+    BENCHMARK("avidpt_edl parse_file + markers section text")
+    {
+        vtm::avidpt_edl edl;
+        edl.parse_file(path);
+        return edl.section_text(vtm::edl::internal::__AvidPTEDLSection::markers_listing).size();
+    };
+}
+
+TEST_CASE("vtm::avidpt_edl Parallel Track Parse Scaling", "[EDL File][parse][parallel][benchmark]")
+{
+    // 5000 tracks x 40 events, track listing parsed on 1 to N threads
+    const auto path = (std::filesystem::temp_directory_path() / "vtm_edlfile_bench_tracks.txt").string();
+    std::ofstream(path, std::ios::binary) << make_session(5000, 40);
+
+    const std::size_t hardware = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+        vtm::utility::thread_pool pool(threads - 1);
+
+        BENCHMARK(fmt::format("avidpt_edl tracks() on {} thread(s)", threads))
+        {
+            vtm::avidpt_edl edl;
+            edl.set_thread_pool(&pool);
+            edl.parse_file(path);
+            return edl.tracks().size();
+        };
+    }
+}
+
+TEST_CASE("vtm::avidpt_edl_columnar Time Range Scans", "[EDL File][columnar][benchmark]")
+{
+    // 1000 tracks x 200 events, events overlapping a 2 second window on every track
+    const auto path = (std::filesystem::temp_directory_path() / "vtm_edlfile_bench_columnar.txt").string();
+    std::ofstream(path, std::ios::binary) << make_session(1000, 200);
+
+    vtm::avidpt_edl rows;
+    vtm::avidpt_edl_columnar columns;
+    rows.parse_file(path);
+    columns.parse_file(path);
+    rows.tracks();
+    columns.tracks();
+
+    const vtm::chrono::float64_t lo = 3610.0 / 100.0;
+    const vtm::chrono::float64_t hi = 3612.0 / 100.0;
+
+    BENCHMARK("vector<pair<index, event>> range scan")
+    {
+        std::size_t hits = 0;
+        for (const auto& [t, track] : rows.tracks()) {
+            for (const auto& [i, event] : track.events) hits += event.start_time < hi && event.end_time > lo;
+        }
+        return hits;
+    };
+
+    BENCHMARK("__AvidPTEventStore range scan")
+    {
+        std::vector<std::size_t> hits;
+        for (const auto& [t, track] : columns.tracks()) track.events.overlapping(lo, hi, hits);
+        return hits.size();
+    };
+
+    BENCHMARK("vector<pair<index, event>> total duration")
+    {
+        vtm::chrono::float64_t total = 0.0;
+        for (const auto& [t, track] : rows.tracks()) {
+            for (const auto& [i, event] : track.events) total += event.duration;
+        }
+        return total;
+    };
+
+    BENCHMARK("__AvidPTEventStore total duration")
+    {
+        vtm::chrono::float64_t total = 0.0;
+        for (const auto& [t, track] : columns.tracks()) total += track.events.total_duration();
+        return total;
+    };
+}
+
+TEST_CASE("vtm::avidpt_edl Time Range Queries", "[EDL File][index][benchmark]")
+{
+    // 1000 tracks x 200 events, 1000 windows of 2 seconds spread over the timeline
+    const auto path = (std::filesystem::temp_directory_path() / "vtm_edlfile_bench_ranges.txt").string();
+    std::ofstream(path, std::ios::binary) << make_session(1000, 200);
+
+    vtm::avidpt_edl edl;
+    edl.parse_file(path);
+
+    const auto& events = edl.tracks().front().second.events;
+    std::vector<std::pair<vtm::chrono::float64_t, vtm::chrono::float64_t>> windows;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        const auto& event = events[(i * 7919) % events.size()].second;
+        windows.emplace_back(event.start_time, event.start_time + event.duration * 2);
+    }
+
+    // A full scan per window, 10 windows only
+    BENCHMARK("linear scan over tracks and events, 10 windows")
+    {
+        std::size_t hits = 0;
+        for (const auto& [lo, hi] : std::span(windows).first(10)) {
+            for (const auto& [t, track] : edl.tracks()) {
+                for (const auto& [i, event] : track.events) hits += event.start_time < hi && event.end_time > lo;
+            }
+        }
+        return hits;
+    };
+
+    BENCHMARK("events_in_range, 1000 windows")
+    {
+        std::size_t hits = 0;
+        std::vector<vtm::edl::internal::__AvidPTEventRef> found;
+        for (const auto& [lo, hi] : windows) {
+            found.clear();
+            edl.events_in_range(lo, hi, found);
+            hits += found.size();
+        }
+        return hits;
+    };
+
+    BENCHMARK("parse_file + tracks() + name and range index build")
+    {
+        vtm::avidpt_edl fresh;
+        fresh.parse_file(path);
+        return fresh.tracks().size();
+    };
+}
+
+TEST_CASE("vtm::avidpt_edl Name Lookups", "[EDL File][index][benchmark]")
+{
+    // 10000 clip name lookups over 1000 tracks x 200 events
+    const auto path = (std::filesystem::temp_directory_path() / "vtm_edlfile_bench_lookup.txt").string();
+    std::ofstream(path, std::ios::binary) << make_session(1000, 200);
+
+    vtm::avidpt_edl edl;
+    edl.parse_file(path);
+    edl.tracks();
+
+    std::vector<std::string> names;
+    for (int i = 0; i < 10000; ++i) names.push_back(fmt::format("clip_{}_{:<20}", (i * 7919) % 1000, (i * 104729) % 200));
+
+    // A full scan per name, 100 names only
+    BENCHMARK("linear scan over tracks and events, 100 names")
+    {
+        std::size_t hits = 0;
+        for (const auto& name : std::span(names).first(100)) {
+            for (const auto& [t, track] : edl.tracks()) {
+                for (const auto& [i, event] : track.events) hits += event.name == name;
+            }
+        }
+        return hits;
+    };
+
+    BENCHMARK("find_events, 10000 names")
+    {
+        std::size_t hits = 0;
+        for (const auto& name : names) hits += edl.find_events(name).size();
+        return hits;
+    };
+
+    BENCHMARK("parse_file + tracks() + name index build")
+    {
+        vtm::avidpt_edl fresh;
+        fresh.parse_file(path);
+        return fresh.find_tracks("Track 0").size();
+    };
+}
+
+TEST_CASE("vtm::avidpt_edl Write Throughput", "[EDL File][write][benchmark]")
+{
+    // 5000 tracks x 200 events, about 100 MB written per iteration
+    const auto path = (std::filesystem::temp_directory_path() / "vtm_edlfile_bench_write.txt").string();
+    const auto copy = (std::filesystem::temp_directory_path() / "vtm_edlfile_bench_write_copy.txt").string();
+    std::ofstream(path, std::ios::binary) << make_session(5000, 200);
+
+    vtm::avidpt_edl edl;
+    edl.parse_file(path);
+    const auto& data = edl.data();
+
+    // A row at a time through fmt::format and std::ofstream
+    BENCHMARK("std::ofstream + fmt::format per row (baseline)")
+    {
+        const auto format = vtm::edl::internal::__AvidPTTimeFormat<vtm::chrono::float64_t>::from_session(data.timecode_format, data.sample_rate);
+        const auto tc = [&](const vtm::chrono::float64_t ticks) {
+            char text[32];
+            return std::string(text, format.format_to(text, ticks));
+        };
+
+        std::ofstream out(copy, std::ios::binary);
+        for (const auto& [t, track] : data.tracks) {
+            out << fmt::format("TRACK NAME:\t{}\nCOMMENTS:\t{}\n", track.name, track.comments);
+            for (const auto& [i, event] : track.events) {
+                out << fmt::format("{:<8}\t{:<8}\t{:<30}\t{:<14}\t{:<14}\t{:<14}\t{}\n", event.channel, event.id, event.name,
+                                   tc(event.start_time), tc(event.end_time), tc(event.duration), event.state);
+            }
+        }
+        return out.tellp();
+    };
+
+    BENCHMARK("write_file, one buffer")
+    {
+        edl.write_file(copy, SIZE_MAX);
+        return std::filesystem::file_size(copy);
+    };
+
+    BENCHMARK("write_file, 16 MiB flushes")
+    {
+        edl.write_file(copy);
+        return std::filesystem::file_size(copy);
+    };
+}
+
+TEST_CASE("vtm::edl::ingest Batch Scaling", "[EDL File][parse][parallel][benchmark]")
+{
+    // 400 reels of 4 tracks and two of 2000 tracks, the large ones listed last
+    std::vector<std::string> paths;
+    for (int f = 0; f < 402; ++f) {
+        const auto path = (std::filesystem::temp_directory_path() / fmt::format("vtm_edlfile_bench_ingest_{}.txt", f)).string();
+        std::ofstream(path, std::ios::binary) << make_session(f < 400 ? 4 : 2000, 40);
+        paths.push_back(path);
+    }
+
+    BENCHMARK("avidpt_edl one file after another")
+    {
+        std::size_t tracks = 0;
+        for (const auto& path : paths) {
+            vtm::avidpt_edl edl;
+            edl.parse_file(path);
+            tracks += edl.tracks().size();
+        }
+        return tracks;
+    };
+
+    const std::size_t hardware = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+        vtm::utility::thread_pool pool(threads - 1);
+        vtm::edl::ingest_options options;
+        options.pool = &pool;
+
+        BENCHMARK(fmt::format("vtm::edl::ingest on {} thread(s)", threads))
+        {
+            return vtm::edl::ingest(paths, options).size();
+        };
+    }
+}
@@ -0,0 +1,130 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "edlfile.hpp"
+#include "alloc_counter.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define VTM_BENCH_FORK 1
+#endif
+
+namespace {
+
+// 5000 tracks x 200 events, clip names past the small string buffer and
+// shared between tracks the way multitrack recordings are
+auto make_session(const int tracks, const int events) -> std::string
+{
+    std::string text;
+    text += "SESSION NAME:\tArena\nSAMPLE RATE:\t48000.000000\nBIT DEPTH:\t24-bit\n";
+    text += "SESSION START TIMECODE:\t01:00:00:00\nTIMECODE FORMAT:\t25 Frame\n";
+    text += fmt::format("# OF AUDIO TRACKS:\t{}\n\n\nT R A C K  L I S T I N G\n", tracks);
+
+    for (int t = 0; t < tracks; ++t) {
+        text += fmt::format("TRACK NAME:\tProduction Dialog {}\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n", t);
+        text += "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+        for (int e = 0; e < events; ++e) {
+            const int start = 90000 + e * 100;
+            const auto tc = [](const int frames) {
+                return fmt::format("{:02}:{:02}:{:02}:{:02}", frames / 90000, frames / 1500 % 60, frames / 25 % 60, frames % 25);
+            };
+            text += fmt::format("1       \t{:<8}\tReel1_Scene{:03}_Take{:02}_Boom.{:02}\t{}   \t{}   \t{}   \t{}\n",
+                                e + 1, e / 4, e % 4, t % 8, tc(start), tc(start + 50), tc(50), e % 10 ? "Unmuted" : "Muted");
+        }
+        text += "\n\n";
+    }
+
+    return text;
+}
+
+// Runs parse in a child process and prints the allocations it made and its
+// peak resident set, so each parser starts from the same baseline. parse
+// returns the count of events it saw
+template<typename F>
+auto report_memory(const char* label, F&& parse) -> void
+{
+#if defined(VTM_BENCH_FORK)
+    std::fflush(stdout);
+    const pid_t child = ::fork();
+    if (child == 0) {
+        const vtm::bench::allocation_scope scope;
+        const std::size_t events = parse();
+
+        rusage usage{};
+        ::getrusage(RUSAGE_SELF, &usage);
+        fmt::print("{:<20} events: {}  allocations: {} ({} MB)  peak RSS: {} KB\n",
+                   label, events, scope.allocations(), scope.allocated_bytes() >> 20, usage.ru_maxrss);
+        std::fflush(stdout);
+        ::_exit(0);
+    }
+
+    int status = 0;
+    ::waitpid(child, &status, 0);
+#else
+    (void)label;
+    (void)parse;
+#endif
+}
+
+template<typename T>
+auto count_events(const std::string& path) -> std::size_t
+{
+    T edl;
+    edl.parse_file(path);
+
+    std::size_t events = 0;
+    for (const auto& [i, track] : edl.tracks()) events += track.events.size();
+    return events;
+}
+
+struct event_counter
+{
+    std::size_t events = 0;
+    void on_event(const auto&, const auto&) { ++this->events; }
+};
+
+} // namespace
+
+TEST_CASE("vtm::avidpt_edl_arena Allocations", "[EDL File][parse][arena][benchmark]")
+{
+    const auto path = (std::filesystem::temp_directory_path() / "vtm_edlfile_bench_arena.txt").string();
+    {
+        const std::string text = make_session(5000, 200);
+        std::ofstream(path, std::ios::binary) << text;
+        fmt::print("session size: {:.1f} MB\n", double(text.size()) / 1e6);
+    }
+
+    report_memory("avidpt_edl", [&]() { return count_events<vtm::avidpt_edl>(path); });
+    report_memory("avidpt_edl_arena", [&]() { return count_events<vtm::avidpt_edl_arena>(path); });
+    report_memory("parse_stream", [&]() {
+        event_counter counter;
+        vtm::edl::parse_stream(path, counter);
+        return counter.events;
+    });
+
+    BENCHMARK("avidpt_edl parse + teardown")
+    {
+        vtm::avidpt_edl edl;
+        edl.parse_file(path);
+        return edl.tracks().size();
+    };
+
+    BENCHMARK("avidpt_edl_arena parse + teardown")
+    {
+        vtm::avidpt_edl_arena edl;
+        edl.parse_file(path);
+        return edl.tracks().size();
+    };
+
+    BENCHMARK("parse_stream, 64 KiB chunks")
+    {
+        event_counter counter;
+        vtm::edl::parse_stream(path, counter);
+        return counter.events;
+    };
+}
@@ -0,0 +1,79 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "edlfile.hpp"
+#include "timecode.hpp"
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// Linear scan over the same names, what DECLARE_ENUM_MAPPING compiled to before the hash tables
+template<std::size_t N>
+auto linear_lookup(const std::array<std::string_view, N>& names, const std::string_view name) -> std::size_t
+{
+    return static_cast<std::size_t>(std::find(names.begin(), names.end(), name) - names.begin());
+}
+
+} // @END OF namespace
+
+TEST_CASE("DECLARE_ENUM_MAPPING String Lookup Throughput", "[utility][enum][benchmark]")
+{
+    constexpr std::array<std::string_view, 6> fps_names {
+        "24 fps", "25 fps", "30 fps", "29.97 fps", "29.97 fps drop-frame", "60 fps"
+    };
+
+    constexpr std::array<std::string_view, 7> section_names {
+        "HEADER",
+        "M A R K E R S  L I S T I N G",
+        "O F F L I N E  F I L E S  I N  S E S S I O N",
+        "O N L I N E  C L I P S  I N  S E S S I O N",
+        "O N L I N E  F I L E S  I N  S E S S I O N",
+        "P L U G - I N S  L I S T I N G",
+        "T R A C K  L I S T I N G"
+    };
+
+    // Per-line parse loop style input, weighted toward the last entries
+    std::vector<std::string_view> fps_input;
+    std::vector<std::string_view> section_input;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        fps_input.push_back(fps_names[fps_names.size() - 1 - i % 3]);
+        section_input.push_back(section_names[section_names.size() - 1 - i % 4]);
+    }
+
+    BENCHMARK("linear scan fps names x10000")
+    {
+        std::size_t sum = 0;
+        for (const auto& name : fps_input) sum += linear_lookup(fps_names, name);
+        return sum;
+    };
+
+    BENCHMARK("__FPSFORMAT_STRING_TO_VALUE x10000")
+    {
+        std::size_t sum = 0;
+        for (const auto& name : fps_input) sum += static_cast<std::size_t>(__FPSFORMAT_STRING_TO_VALUE(name));
+        return sum;
+    };
+
+    BENCHMARK("linear scan section names x10000")
+    {
+        std::size_t sum = 0;
+        for (const auto& name : section_input) sum += linear_lookup(section_names, name);
+        return sum;
+    };
+
+    BENCHMARK("__AVIDPTEDL_STRING_TO_VALUE x10000")
+    {
+        std::size_t sum = 0;
+        for (const auto& name : section_input) sum += static_cast<std::size_t>(__AVIDPTEDL_STRING_TO_VALUE(name));
+        return sum;
+    };
+
+    BENCHMARK("__FPSFORMAT_VALUE_TO_FLOAT x10000")
+    {
+        vtm::fpsfloat_t sum = 0.0;
+        for (std::size_t i = 0; i < 10000; ++i) sum += __FPSFORMAT_VALUE_TO_FLOAT(static_cast<vtm::fps::type>(i % 6));
+        return sum;
+    };
+}
@@ -0,0 +1,54 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <cstdint>
+#include <vector>
+
+TEST_CASE("vtm::timecode_column Offset & Scale Throughput", "[timecode][chrono][column][benchmark]")
+{
+    // Reel offset and pull-up over a large event list, one timecode per element
+    // against one kernel pass over the column
+    constexpr int count = 1000000;
+    std::vector<vtm::f64timecode> f64s;
+    vtm::timecode_column column{ vtm::fps::fps_25 };
+    f64s.reserve(count);
+    column.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const vtm::fpsfloat_t ticks = vtm::fpsfloat_t(vtm::fpsint_t(i) * 7919 % (24 * 3600 * 25)) * 0.0004;
+        f64s.emplace_back(ticks, vtm::fps::fps_25);
+        column.push_back(ticks);
+    }
+
+    const auto offset = vtm::f64timecode::from_string("01:00:00:00", vtm::fps::fps_25);
+    std::vector<std::int8_t> order(count);
+
+    BENCHMARK("f64timecode offset x1000000")
+    {
+        for (auto& tc : f64s) tc = tc + offset;
+        return f64s.back().as_float();
+    };
+
+    BENCHMARK("timecode_column offset x1000000")
+    {
+        column.offset(offset);
+        return column.values().back();
+    };
+
+    BENCHMARK("f64timecode scale + clamp x1000000")
+    {
+        for (auto& tc : f64s) tc.set_value(std::min(tc.as_float() * (1001.0L / 1000.0L), 86400.0L));
+        return f64s.back().as_float();
+    };
+
+    BENCHMARK("timecode_column scale + clamp x1000000")
+    {
+        column.scale(1001.0 / 1000.0).clamp(0.0, 864.0);
+        return column.values().back();
+    };
+
+    BENCHMARK("timecode_column compare x1000000")
+    {
+        column.compare(offset, order);
+        return order.back();
+    };
+}
@@ -0,0 +1,48 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("vtm::dense_timecode Copy & Sort Throughput", "[timecode][chrono][dense][benchmark]")
+{
+    // Timeline sized arrays, copied and sorted the way an EDL conform would
+    constexpr int count = 100000;
+    std::vector<vtm::f64timecode> f64s;
+    std::vector<vtm::dense_timecode> denses;
+    f64s.reserve(count);
+    denses.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const vtm::fpsfloat_t ticks = vtm::fpsfloat_t(vtm::fpsint_t(i) * 7919 % (24 * 3600 * 25)) * 0.0004;
+        f64s.emplace_back(ticks, vtm::fps::fps_25);
+        denses.emplace_back(ticks, vtm::fps::fps_25);
+    }
+
+    WARN("sizeof(f64timecode): " << sizeof(vtm::f64timecode) << " sizeof(dense_timecode): " << sizeof(vtm::dense_timecode));
+
+    BENCHMARK("f64timecode copy x100000")
+    {
+        std::vector<vtm::f64timecode> copy(f64s);
+        return copy.size();
+    };
+
+    BENCHMARK("dense_timecode copy x100000")
+    {
+        std::vector<vtm::dense_timecode> copy(denses);
+        return copy.size();
+    };
+
+    BENCHMARK("f64timecode copy + sort x100000")
+    {
+        std::vector<vtm::f64timecode> copy(f64s);
+        std::sort(copy.begin(), copy.end(), [](const auto& a, const auto& b) { return a.as_float() < b.as_float(); });
+        return copy.front().as_float();
+    };
+
+    BENCHMARK("dense_timecode copy + sort x100000")
+    {
+        std::vector<vtm::dense_timecode> copy(denses);
+        std::sort(copy.begin(), copy.end(), [](const auto& a, const auto& b) { return a < b; });
+        return copy.front().as_float();
+    };
+}
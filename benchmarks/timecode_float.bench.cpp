@@ -0,0 +1,208 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "alloc_counter.hpp"
+#include "timecode.hpp"
+#include <string>
+#include <vector>
+
+TEST_CASE("vtm::f64timecode Formatting Allocations", "[timecode][chrono][string][benchmark]")
+{
+    const auto tc = vtm::f64timecode::from_string("10:59:59:24", vtm::fps::fps_25);
+    char buffer[VTM_TCSTRING_FIXED_SIZE];
+    fmt::memory_buffer out;
+    out.reserve(64);
+
+    std::size_t as_string_allocs = 0;
+    {
+        const vtm::bench::allocation_scope scope;
+        const auto str = tc.as_string();
+        as_string_allocs = scope.allocations();
+    }
+
+    std::size_t format_to_allocs = 0;
+    {
+        const vtm::bench::allocation_scope scope;
+        tc.format_to(buffer);
+        format_to_allocs = scope.allocations();
+    }
+
+    std::size_t fmt_allocs = 0;
+    {
+        const vtm::bench::allocation_scope scope;
+        fmt::format_to(std::back_inserter(out), "{}", tc);
+        fmt_allocs = scope.allocations();
+    }
+
+    fmt::print("allocations per as_string(): {}\n", as_string_allocs);
+    fmt::print("allocations per format_to(): {}\n", format_to_allocs);
+    fmt::print("allocations per fmt::format_to(): {}\n", fmt_allocs);
+
+    REQUIRE(as_string_allocs == 0);
+    REQUIRE(format_to_allocs == 0);
+    REQUIRE(fmt_allocs == 0);
+}
+
+TEST_CASE("vtm::f64timecode Formatting Throughput", "[timecode][chrono][string][benchmark]")
+{
+    std::vector<vtm::f64timecode> timecodes;
+    for (int i = 0; i < 1000; ++i) {
+        timecodes.emplace_back(vtm::f64timecode::from_hmsf(i % 24, i % 60, (i * 7) % 60, i % 25, vtm::fps::fps_25));
+    }
+
+    BENCHMARK("as_string() x1000")
+    {
+        std::size_t total = 0;
+        for (const auto& tc : timecodes) total += tc.as_string().size();
+        return total;
+    };
+
+    BENCHMARK("format_to() x1000")
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE * 1000];
+        char* out = buffer;
+        for (const auto& tc : timecodes) out = tc.format_to(out);
+        return out[-1];
+    };
+
+    BENCHMARK("fmt::format_to() x1000")
+    {
+        fmt::memory_buffer out;
+        for (const auto& tc : timecodes) fmt::format_to(std::back_inserter(out), "{}", tc);
+        return out.size();
+    };
+}
+
+TEST_CASE("vtm::f64timecode Parsing Throughput", "[timecode][chrono][string][benchmark]")
+{
+    std::vector<std::string> strings;
+    for (int i = 0; i < 1000; ++i) {
+        strings.emplace_back(fmt::format("{:02}:{:02}:{:02}:{:02}", i % 24, i % 60, (i * 7) % 60, i % 25));
+    }
+
+    BENCHMARK("from_string() x1000")
+    {
+        vtm::fpsfloat_t total = 0.0;
+        for (const auto& s : strings) total += vtm::f64timecode::from_string(s, vtm::fps::fps_25).as_float();
+        return total;
+    };
+}
+
+TEST_CASE("vtm::chrono Batch Conversion Throughput", "[timecode][chrono][batch][benchmark]")
+{
+    constexpr std::size_t count = 100000;
+    std::vector<std::string> strings;
+    std::vector<std::string_view> views;
+    strings.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        strings.emplace_back(fmt::format("{:02}:{:02}:{:02}:{:02}", i % 24, i % 60, (i * 7) % 60, i % 25));
+    }
+    for (const auto& s : strings) views.emplace_back(s);
+
+    std::vector<vtm::fpsfloat_t> ticks(count);
+    std::vector<std::uint64_t> invalid(vtm::chrono::tcbitmap_words(count));
+    std::string out(count * VTM_TCSTRING_FIXED_SIZE, '\0');
+    vtm::chrono::parse_timecodes(views, vtm::fps::fps_25, ticks, invalid);
+
+    BENCHMARK("from_string() x100000")
+    {
+        vtm::fpsfloat_t total = 0.0;
+        for (const auto& v : views) total += vtm::f64timecode::from_string(v, vtm::fps::fps_25).as_float();
+        return total;
+    };
+
+    BENCHMARK("parse_timecodes() x100000")
+    {
+        return vtm::chrono::parse_timecodes(views, vtm::fps::fps_25, ticks, invalid);
+    };
+
+    BENCHMARK("as_string() x100000")
+    {
+        std::size_t total = 0;
+        for (const auto& t : ticks) total += vtm::f64timecode{t, vtm::fps::fps_25}.as_string().size();
+        return total;
+    };
+
+    BENCHMARK("format_timecodes() x100000")
+    {
+        return vtm::chrono::format_timecodes(ticks, vtm::fps::fps_25, out.data(), invalid);
+    };
+}
+
+TEST_CASE("vtm::chrono Drop-Frame Conversion Throughput", "[timecode][chrono][dropframe][benchmark]")
+{
+    // One day of 29.97 drop-frame frames
+    constexpr std::uint64_t count = 2589408;
+    std::vector<std::uint64_t> frames(count);
+    for (std::uint64_t i = 0; i < count; ++i) frames[i] = i;
+
+    std::string out(count * VTM_TCSTRING_FIXED_SIZE, '\0');
+    std::vector<std::string_view> views(count);
+    std::vector<std::uint64_t> parsed(count);
+    vtm::chrono::format_dropframe(frames, out.data());
+    for (std::uint64_t i = 0; i < count; ++i) views[i] = std::string_view(out).substr(i * VTM_TCSTRING_FIXED_SIZE, VTM_TCSTRING_FIXED_SIZE);
+
+    BENCHMARK("dropframe_to_fields() x24h")
+    {
+        std::uint64_t total = 0;
+        for (const auto f : frames) total += vtm::chrono::dropframe_to_fields(f).frames;
+        return total;
+    };
+
+    BENCHMARK("format_dropframe() x24h")
+    {
+        vtm::chrono::format_dropframe(frames, out.data());
+        return out.back();
+    };
+
+    BENCHMARK("parse_dropframe() x24h")
+    {
+        return vtm::chrono::parse_dropframe(views, parsed);
+    };
+}
+
+TEST_CASE("vtm::fixed_timecode Conversion Throughput", "[timecode][chrono][fixed][benchmark]")
+{
+    using tc25 = vtm::fixed_timecode<vtm::fps::fps_25>;
+
+    std::vector<std::string> strings;
+    for (int i = 0; i < 1000; ++i) {
+        strings.emplace_back(fmt::format("{:02}:{:02}:{:02}:{:02}", i % 24, i % 60, (i * 7) % 60, i % 25));
+    }
+
+    BENCHMARK("f64timecode::from_string() x1000")
+    {
+        vtm::fpsfloat_t total = 0.0;
+        for (const auto& s : strings) total += vtm::f64timecode::from_string(s, vtm::fps::fps_25).as_float();
+        return total;
+    };
+
+    BENCHMARK("fixed_timecode::from_string() x1000")
+    {
+        vtm::fpsfloat_t total = 0.0;
+        for (const auto& s : strings) total += tc25::from_string(s).as_float();
+        return total;
+    };
+
+    std::vector<vtm::f64timecode> f64s;
+    std::vector<tc25> fixeds;
+    for (const auto& s : strings) {
+        f64s.emplace_back(vtm::f64timecode::from_string(s, vtm::fps::fps_25));
+        fixeds.emplace_back(tc25::from_string(s));
+    }
+
+    BENCHMARK("f64timecode::format_to() x1000")
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE * 1000];
+        char* out = buffer;
+        for (const auto& tc : f64s) out = tc.format_to(out);
+        return out[-1];
+    };
+
+    BENCHMARK("fixed_timecode::format_to() x1000")
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE * 1000];
+        char* out = buffer;
+        for (const auto& tc : fixeds) out = tc.format_to(out);
+        return out[-1];
+    };
+}
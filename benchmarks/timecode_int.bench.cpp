@@ -0,0 +1,42 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <vector>
+
+TEST_CASE("vtm::timecode Offset & Format Throughput", "[timecode][chrono][arithmetic][benchmark]")
+{
+    // Caption export style loop: shift every event by a fixed offset and write its label
+    constexpr int count = 10000;
+    std::vector<vtm::f64timecode> f64s;
+    std::vector<vtm::timecode> packed;
+    for (int i = 0; i < count; ++i) {
+        const vtm::fpsint_t frames = vtm::fpsint_t(i) * 997 % (24 * 3600 * 25);
+        packed.emplace_back(frames, vtm::fps::fps_25);
+        f64s.emplace_back(packed.back().as_float(), vtm::fps::fps_25);
+    }
+
+    const auto f64_offset = vtm::f64timecode::from_string("01:00:00:12", vtm::fps::fps_25);
+    const auto packed_offset = vtm::timecode::from_string("01:00:00:12", vtm::fps::fps_25);
+    std::vector<char> out(count * VTM_TCSTRING_FIXED_SIZE);
+
+    BENCHMARK("f64timecode offset + format_to() x10000")
+    {
+        char* p = out.data();
+        for (const auto& tc : f64s) p = (tc + f64_offset).format_to(p);
+        return p[-1];
+    };
+
+    BENCHMARK("timecode offset + format_to() x10000")
+    {
+        char* p = out.data();
+        for (const auto& tc : packed) p = (tc + packed_offset).format_to(p);
+        return p[-1];
+    };
+
+    BENCHMARK("timecode format_to() x10000")
+    {
+        char* p = out.data();
+        for (const auto& tc : packed) p = tc.format_to(p);
+        return p[-1];
+    };
+}
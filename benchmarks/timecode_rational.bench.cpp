@@ -0,0 +1,89 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <vector>
+
+TEST_CASE("vtm::r64timecode 24h Accumulation Drift", "[timecode][chrono][rational][benchmark]")
+{
+    // Step one frame at a time through a full day in both representations and
+    // compare against the label the same frame count should land on
+    for (const auto fps : { vtm::fps::fps_24, vtm::fps::fps_25, vtm::fps::fps_29p97 }) {
+        const auto frames = 24 * 3600 * vtm::r64timecode::nominal_rate(fps);
+
+        auto f = vtm::f64timecode::from_hmsf(0, 0, 0, 0, fps);
+        const auto f_step = vtm::f64timecode::from_hmsf(0, 0, 0, 1, fps);
+        for (vtm::fpsint_t i = 0; i < frames; ++i) f += f_step;
+
+        auto r = vtm::r64timecode::from_frames(0, 0, fps);
+        const auto r_step = vtm::r64timecode::from_frames(1, 0, fps);
+        for (vtm::fpsint_t i = 0; i < frames; ++i) r += r_step;
+
+        const auto f_exact = f_step.as_float() * vtm::fpsfloat_t(frames);
+        fmt::print("{} fps, {} frames\n", double(vtm::fps::to_float(fps)), frames);
+        fmt::print("  f64timecode: {} (drift {:e} ticks, {:e} frames)\n", f.as_string(),
+                   double(f.as_float() - f_exact), double((f.as_float() - f_exact) / f_step.as_float()));
+        fmt::print("  r64timecode: {} (drift {} subframes)\n", r.as_string(),
+                   r.subframes() - frames * vtm::r64timecode::subframes_per_frame);
+
+        REQUIRE(r.as_string() == "24:00:00:00");
+        REQUIRE(r.frames() == frames);
+    }
+}
+
+TEST_CASE("vtm::r64timecode Arithmetic Throughput", "[timecode][chrono][rational][benchmark]")
+{
+    constexpr int frames = 24 * 3600 * 30;
+
+    BENCHMARK("f64timecode += 1 frame, 24h at 29.97")
+    {
+        auto tc = vtm::f64timecode::from_string("00:00:00:00", vtm::fps::fps_29p97);
+        const auto step = vtm::f64timecode::from_hmsf(0, 0, 0, 1, vtm::fps::fps_29p97);
+        for (int i = 0; i < frames; ++i) tc += step;
+        return tc.as_float();
+    };
+
+    BENCHMARK("r64timecode += 1 frame, 24h at 29.97")
+    {
+        auto tc = vtm::r64timecode::from_frames(0, 0, vtm::fps::fps_29p97);
+        const auto step = vtm::r64timecode::from_frames(1, 0, vtm::fps::fps_29p97);
+        for (int i = 0; i < frames; ++i) tc += step;
+        return tc.subframes();
+    };
+
+    std::vector<vtm::f64timecode> f64s;
+    std::vector<vtm::r64timecode> r64s;
+    for (int i = 0; i < 1000; ++i) {
+        f64s.emplace_back(vtm::f64timecode::from_hmsf(i % 24, i % 60, (i * 7) % 60, i % 30, vtm::fps::fps_29p97));
+        r64s.emplace_back(vtm::r64timecode::from_hmsf(i % 24, i % 60, (i * 7) % 60, i % 30, vtm::fps::fps_29p97));
+    }
+
+    BENCHMARK("f64timecode compare x1000")
+    {
+        int total = 0;
+        for (std::size_t i = 1; i < f64s.size(); ++i) total += f64s[i - 1] < f64s[i];
+        return total;
+    };
+
+    BENCHMARK("r64timecode compare x1000")
+    {
+        int total = 0;
+        for (std::size_t i = 1; i < r64s.size(); ++i) total += r64s[i - 1] < r64s[i];
+        return total;
+    };
+
+    BENCHMARK("f64timecode format_to() x1000")
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE * 1000];
+        char* out = buffer;
+        for (const auto& tc : f64s) out = tc.format_to(out);
+        return out[-1];
+    };
+
+    BENCHMARK("r64timecode format_to() x1000")
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE * 1000];
+        char* out = buffer;
+        for (const auto& tc : r64s) out = tc.format_to(out);
+        return out[-1];
+    };
+}
@@ -0,0 +1,43 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "timecode.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST_CASE("vtm::chrono::sort_timecodes Throughput", "[timecode][chrono][sort][benchmark]")
+{
+    // Event list sized sort, comparison sort against the radix sort over ordering keys
+    constexpr int count = 1000000;
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<vtm::fpsint_t> frames(0, 24 * 3600 * 25 - 1);
+    std::vector<vtm::dense_timecode> tcs;
+    vtm::timecode_column column{ vtm::fps::fps_25 };
+    tcs.reserve(count);
+    column.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const vtm::fpsfloat_t ticks = vtm::fpsfloat_t(frames(rng)) * 0.0004;
+        tcs.emplace_back(ticks, vtm::fps::fps_25);
+        column.push_back(ticks);
+    }
+
+    BENCHMARK("std::stable_sort dense_timecode x1000000")
+    {
+        auto copy = tcs;
+        std::stable_sort(copy.begin(), copy.end(), [](const auto& a, const auto& b) { return a < b; });
+        return copy.front().as_float();
+    };
+
+    BENCHMARK("sort_timecodes dense_timecode x1000000")
+    {
+        auto copy = tcs;
+        vtm::chrono::sort_timecodes(std::span(copy));
+        return copy.front().as_float();
+    };
+
+    BENCHMARK("sorted_order timecode_column x1000000")
+    {
+        return vtm::chrono::sorted_order(column).front();
+    };
+}
@@ -0,0 +1,648 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Binary cache of parsed Pro Tools EDL sessions, read in place
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Project headers
+#include "edlfile.hpp"
+#include "file_writer.hpp"
+#include "mapped_file.hpp"
+
+// Library headers
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Avid Pro Tools EDL Cache Format --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::edl::internal {
+
+// @SECTION: 64-bit hash of a whole file, four independent lanes over 32 byte
+// blocks so the multiplies overlap. Only compared against itself, the value
+// is not any published hash
+inline auto avidpt_content_hash(const std::string_view bytes) noexcept -> std::uint64_t
+{
+    constexpr std::uint64_t p1 = 0x9E3779B185EBCA87ull;
+    constexpr std::uint64_t p2 = 0xC2B2AE3D27D4EB4Full;
+
+    const auto load = [](const char* p) noexcept {
+        std::uint64_t word = 0;
+        std::memcpy(&word, p, sizeof(word));
+        return word;
+    };
+    const auto round = [](const std::uint64_t acc, const std::uint64_t word) noexcept {
+        return std::rotl(acc + word * p2, 31) * p1;
+    };
+
+    std::array<std::uint64_t, 4> lanes{ p1 + p2, p2, 0, 0 - p1 };
+    const char* p = bytes.data();
+    std::size_t left = bytes.size();
+    for (; left >= 32; p += 32, left -= 32) {
+        for (std::size_t i = 0; i < 4; ++i) lanes[i] = round(lanes[i], load(p + i * 8));
+    }
+
+    std::uint64_t hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+    for (; left >= 8; p += 8, left -= 8) hash = round(hash, load(p));
+    if (left > 0) {
+        std::uint64_t tail = 0;
+        std::memcpy(&tail, p, left);
+        hash = round(hash, tail);
+    }
+
+    hash ^= bytes.size();
+    hash ^= hash >> 33;
+    hash *= p2;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+// @SECTION: Size and modification time of a source file, checked on every
+// open. The content hash is only computed when these disagree
+struct __AvidPTSourceStamp
+{
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0; // Nanoseconds of the filesystem clock
+
+    // Empty when the file cannot be read
+    static auto of(const std::string_view path) -> std::optional<__AvidPTSourceStamp>
+    {
+        const std::filesystem::path file(path);
+        std::error_code ec;
+
+        const auto size = std::filesystem::file_size(file, ec);
+        if (ec) return std::nullopt;
+        const auto time = std::filesystem::last_write_time(file, ec);
+        if (ec) return std::nullopt;
+
+        const auto mtime = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+        return __AvidPTSourceStamp{ std::uint64_t(size), std::int64_t(mtime) };
+    }
+};
+
+// @SECTION: On-disk records. Every section starts on an 8 byte boundary of a
+// page aligned mapping and is read in place, strings are offsets into one
+// heap of interned text. Fields are in native byte order, a cache written on
+// a machine of the other order is rejected and rebuilt
+struct __AvidPTCacheString
+{
+    std::uint32_t offset = 0;
+    std::uint32_t size = 0;
+};
+
+struct __AvidPTCacheHeader
+{
+    std::array<char, 8> magic{};
+    std::uint32_t version = 0;
+    std::uint32_t byte_order = 0;
+    std::uint64_t file_size = 0;
+
+    // Source the cache was built from
+    std::uint64_t source_size = 0;
+    std::int64_t source_mtime = 0;
+    std::uint64_t source_hash = 0;
+    __AvidPTCacheString source_path;
+
+    // Session header, times in units of the session time format
+    __AvidPTCacheString session_name;
+    std::uint32_t sample_rate = 0;
+    std::uint32_t bit_depth = 0;
+    std::uint32_t audio_clips = 0;
+    std::uint32_t audio_files = 0;
+    std::uint32_t audio_tracks = 0;
+    std::int32_t timecode_format = 0;
+    std::int64_t session_start = 0;
+
+    std::uint64_t track_count = 0;
+    std::uint64_t event_count = 0;
+
+    // Byte offsets of each section from the start of the file
+    std::uint64_t tracks = 0;
+    std::uint64_t ids = 0;
+    std::uint64_t channels = 0;
+    std::uint64_t start_times = 0;
+    std::uint64_t end_times = 0;
+    std::uint64_t durations = 0;
+    std::uint64_t names = 0;
+    std::uint64_t states = 0;
+    std::uint64_t heap = 0;
+    std::uint64_t heap_size = 0;
+};
+
+// Events of a track are rows [first_event, first_event + event_count) of the
+// event columns
+struct __AvidPTCacheTrack
+{
+    __AvidPTCacheString name;
+    __AvidPTCacheString comments;
+    std::uint32_t delay = 0;
+    std::uint32_t delay_unit = 0;
+    std::uint64_t state = 0;
+    std::uint64_t first_event = 0;
+    std::uint64_t event_count = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<__AvidPTCacheHeader> && sizeof(__AvidPTCacheHeader) == 192);
+static_assert(std::is_trivially_copyable_v<__AvidPTCacheTrack> && sizeof(__AvidPTCacheTrack) == 48);
+
+inline constexpr std::array<char, 8> avidpt_cache_magic{ 'V', 'T', 'M', 'E', 'D', 'L', 'C', '\0' };
+// Version 2 stores frame rates by their restored enumerator values
+inline constexpr std::uint32_t avidpt_cache_version = 2;
+inline constexpr std::uint32_t avidpt_cache_byte_order = 0x01020304;
+
+// @SECTION: Where the cache of a source lives, one file per absolute source
+// path named by its hash
+inline auto avidpt_absolute_path(const std::string_view path) -> std::string
+{
+    return std::filesystem::absolute(std::filesystem::path(path)).lexically_normal().string();
+}
+
+inline auto avidpt_cache_path(const std::string_view source_path, const std::string_view cache_dir) -> std::string
+{
+    const std::uint64_t key = avidpt_content_hash(avidpt_absolute_path(source_path));
+    return (std::filesystem::path(cache_dir) / fmt::format("{:016x}.vtmedl", key)).string();
+}
+
+} // @END OF namespace vtm::edl::internal
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __AvidPTEDLCache --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::edl::internal {
+
+// Parsed session read straight from a mapped cache file. Opening maps the
+// file and checks its header against the source, nothing is copied or
+// converted up front. Times are stored as integers in the units of
+// __AvidPTTimeFormat::to_units() and read back as the ticks a parse of the
+// source returns. Strings view the mapping and stay valid until close()
+class __AvidPTEDLCache
+{
+public:
+    using string_t          = std::string_view;
+    using event_t           = __AvidPTTrackEvent<std::string_view>;
+    using timecode_t        = vtm::chrono::float64_t;
+    using timecode_fmt_t    = typename vtm::fps::type;
+    using timeline_format_t = TimelineUnitFormat;
+    using units_t           = std::int64_t;
+    using source_t          = vtm::utility::internal::__MappedFile;
+    using stamp_t           = __AvidPTSourceStamp;
+    using size_type         = std::size_t;
+
+    // Events of one track, rows read back as (index, event) pairs by value
+    class events_view
+    {
+    public:
+        using value_type = std::pair<size_type, event_t>;
+
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = events_view::value_type;
+            using difference_type   = std::ptrdiff_t;
+
+            const_iterator() = default;
+            const_iterator(const events_view* events, const size_type i) noexcept : _events(events), _i(i) {}
+
+            auto operator*() const -> value_type { return (*this->_events)[this->_i]; }
+            auto operator++() noexcept -> const_iterator& { ++this->_i; return *this; }
+            auto operator++(int) noexcept -> const_iterator { const_iterator it = *this; ++this->_i; return it; }
+            bool operator==(const const_iterator&) const = default;
+
+        private:
+            const events_view* _events = nullptr;
+            size_type _i = 0;
+        };
+
+        events_view(const __AvidPTEDLCache* cache, const size_type first, const size_type count) noexcept
+            : _cache(cache), _first(first), _count(count)
+        {}
+
+        auto size() const noexcept -> size_type { return this->_count; }
+        auto empty() const noexcept -> bool { return this->_count == 0; }
+
+        auto operator[](const size_type i) const -> value_type
+        {
+            VTM_ASSERT(i < this->_count, "cached event index out of range");
+            return { i, this->_cache->event(this->_first + i) };
+        }
+
+        auto begin() const noexcept -> const_iterator { return { this, 0 }; }
+        auto end() const noexcept -> const_iterator { return { this, this->_count }; }
+
+        // Column access, times in cache units
+        auto ids() const noexcept -> std::span<const std::uint32_t> { return this->_cache->ids().subspan(this->_first, this->_count); }
+        auto channels() const noexcept -> std::span<const std::uint32_t> { return this->_cache->channels().subspan(this->_first, this->_count); }
+        auto start_units() const noexcept -> std::span<const units_t> { return this->_cache->start_units().subspan(this->_first, this->_count); }
+        auto end_units() const noexcept -> std::span<const units_t> { return this->_cache->end_units().subspan(this->_first, this->_count); }
+        auto duration_units() const noexcept -> std::span<const units_t> { return this->_cache->duration_units().subspan(this->_first, this->_count); }
+        auto name(const size_type i) const -> string_t { return this->_cache->event_name(this->_first + i); }
+        auto state(const size_type i) const -> string_t { return this->_cache->event_state(this->_first + i); }
+
+    private:
+        const __AvidPTEDLCache* _cache = nullptr;
+        size_type _first = 0;
+        size_type _count = 0;
+    };
+
+    class track_view
+    {
+    public:
+        track_view(const __AvidPTEDLCache* cache, const __AvidPTCacheTrack* record) noexcept
+            : _cache(cache), _record(record)
+        {}
+
+        auto name() const -> string_t { return this->_cache->string(this->_record->name); }
+        auto comments() const -> string_t { return this->_cache->string(this->_record->comments); }
+        auto delay() const noexcept -> std::uint32_t { return this->_record->delay; }
+        auto delay_unit() const noexcept -> timeline_format_t { return timeline_format_t(this->_record->delay_unit); }
+        auto state() const noexcept -> std::uint64_t { return this->_record->state; }
+        auto events() const noexcept -> events_view { return { this->_cache, this->_record->first_event, this->_record->event_count }; }
+
+    private:
+        const __AvidPTEDLCache* _cache = nullptr;
+        const __AvidPTCacheTrack* _record = nullptr;
+    };
+
+public:
+    // Opens cache_path as the cache of source_path, which must be the path the
+    // cache was stored with. Returns false and stays closed when the file is
+    // missing, is not a cache of this version and byte order, or the source
+    // changed. A source whose size and modification time match is trusted,
+    // otherwise its content hash decides. verify_content always hashes
+    auto open(const std::string_view cache_path, const std::string_view source_path, const bool verify_content = false) -> bool
+    {
+        this->close();
+
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(std::filesystem::path(cache_path), ec)) return false;
+
+        try {
+            this->_file.open(cache_path);
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+
+        if (!this->valid_layout() || this->string(this->header().source_path) != source_path) {
+            this->close();
+            return false;
+        }
+
+        const auto stamp = stamp_t::of(source_path);
+        const auto& header = this->header();
+        if (!stamp || stamp->size != header.source_size) {
+            this->close();
+            return false;
+        }
+
+        if (verify_content || stamp->mtime != header.source_mtime) {
+            const source_t source(source_path);
+            if (avidpt_content_hash(source.view()) != header.source_hash) {
+                this->close();
+                return false;
+            }
+        }
+
+        this->_format = format_t::from_session(timecode_fmt_t(header.timecode_format), header.sample_rate);
+        return true;
+    }
+
+    auto close() noexcept -> void
+    {
+        this->_file.close();
+        this->_format = format_t{};
+    }
+
+    auto is_open() const noexcept -> bool
+    {
+        return this->_file.is_open();
+    }
+
+    // Writes data, parsed from source_text, as the cache of source_path.
+    // stamp must be taken before source_text was read, a source modified in
+    // between then fails its hash check on the next open instead of serving
+    // stale data. The file is written beside cache_path and renamed over it,
+    // so readers never map a partial cache
+    template<typename TData>
+    static auto store(const TData& data, const std::string_view source_text, const stamp_t& stamp,
+                      const std::string_view source_path, const std::string_view cache_path) -> void
+    {
+        __AvidPTCacheHeader header;
+        header.magic = avidpt_cache_magic;
+        header.version = avidpt_cache_version;
+        header.byte_order = avidpt_cache_byte_order;
+        header.source_size = stamp.size;
+        header.source_mtime = stamp.mtime;
+        header.source_hash = avidpt_content_hash(source_text);
+
+        // Equal strings are stored once, clip names repeat across tracks
+        std::string heap;
+        std::unordered_map<std::string_view, __AvidPTCacheString> interned;
+        const auto intern = [&](const std::string_view s) -> __AvidPTCacheString {
+            if (s.empty()) return {};
+            if (const auto found = interned.find(s); found != interned.end()) return found->second;
+            if (heap.size() + s.size() > UINT32_MAX) throw std::runtime_error("EDL cache string heap exceeds 4 GiB");
+
+            const __AvidPTCacheString ref{ std::uint32_t(heap.size()), std::uint32_t(s.size()) };
+            heap.append(s);
+            interned.emplace(s, ref);
+            return ref;
+        };
+
+        // Formatted in double like the writer, labels and subframes come out
+        // the same as from the full precision ticks
+        const auto format = __AvidPTTimeFormat<double>::from_session(data.timecode_format, data.sample_rate);
+
+        header.source_path = intern(source_path);
+        header.session_name = intern(std::string_view(data.session_name));
+        header.sample_rate = data.sample_rate;
+        header.bit_depth = data.bit_depth;
+        header.audio_clips = data.audio_clips;
+        header.audio_files = data.audio_files;
+        header.audio_tracks = data.audio_tracks;
+        header.timecode_format = static_cast<std::int32_t>(data.timecode_format);
+        header.session_start = format.to_units(double(data.session_start));
+
+        std::size_t events = 0;
+        for (const auto& [i, track] : data.tracks) events += track.events.size();
+
+        std::vector<__AvidPTCacheTrack> tracks;
+        std::vector<std::uint32_t> ids, channels;
+        std::vector<units_t> start_times, end_times, durations;
+        std::vector<__AvidPTCacheString> names, states;
+        tracks.reserve(data.tracks.size());
+        ids.reserve(events);
+        channels.reserve(events);
+        start_times.reserve(events);
+        end_times.reserve(events);
+        durations.reserve(events);
+        names.reserve(events);
+        states.reserve(events);
+
+        for (const auto& [i, track] : data.tracks) {
+            __AvidPTCacheTrack record;
+            record.name = intern(std::string_view(track.name));
+            record.comments = intern(std::string_view(track.comments));
+            record.delay = track.delay.delay;
+            record.delay_unit = static_cast<std::uint32_t>(track.delay.unit);
+            record.state = track.state;
+            record.first_event = ids.size();
+            record.event_count = track.events.size();
+            tracks.push_back(record);
+
+            for (const auto& [e, event] : track.events) {
+                ids.push_back(event.id);
+                channels.push_back(event.channel);
+                start_times.push_back(format.to_units(double(event.start_time)));
+                end_times.push_back(format.to_units(double(event.end_time)));
+                durations.push_back(format.to_units(double(event.duration)));
+                names.push_back(intern(std::string_view(event.name)));
+                states.push_back(intern(std::string_view(event.state)));
+            }
+        }
+
+        header.track_count = tracks.size();
+        header.event_count = ids.size();
+
+        // Sections in file order, each padded to the next 8 byte boundary
+        constexpr std::array<char, 8> padding{};
+        std::vector<std::string_view> pieces;
+        std::size_t offset = sizeof(header);
+        const auto section = [&](const void* bytes, const std::size_t size) -> std::uint64_t {
+            const std::size_t begin = offset;
+            pieces.emplace_back(static_cast<const char*>(bytes), size);
+            offset += size;
+            if (const std::size_t pad = (8 - offset % 8) % 8; pad > 0) {
+                pieces.emplace_back(padding.data(), pad);
+                offset += pad;
+            }
+            return begin;
+        };
+
+        pieces.emplace_back(reinterpret_cast<const char*>(&header), sizeof(header));
+        header.tracks      = section(tracks.data(), tracks.size() * sizeof(__AvidPTCacheTrack));
+        header.ids         = section(ids.data(), ids.size() * sizeof(std::uint32_t));
+        header.channels    = section(channels.data(), channels.size() * sizeof(std::uint32_t));
+        header.start_times = section(start_times.data(), start_times.size() * sizeof(units_t));
+        header.end_times   = section(end_times.data(), end_times.size() * sizeof(units_t));
+        header.durations   = section(durations.data(), durations.size() * sizeof(units_t));
+        header.names       = section(names.data(), names.size() * sizeof(__AvidPTCacheString));
+        header.states      = section(states.data(), states.size() * sizeof(__AvidPTCacheString));
+        header.heap        = section(heap.data(), heap.size());
+        header.heap_size   = heap.size();
+        header.file_size   = offset;
+
+        // Unique per writer, concurrent stores of one source each rename a
+        // complete file and the last one wins
+        const std::string temp_path = fmt::format("{}.{:08x}.tmp", cache_path, std::random_device{}());
+        try {
+            vtm::utility::internal::__FileWriter file(temp_path);
+            file.write(pieces);
+            file.close();
+            std::filesystem::rename(std::filesystem::path(temp_path), std::filesystem::path(cache_path));
+        } catch (...) {
+            std::error_code ec;
+            std::filesystem::remove(std::filesystem::path(temp_path), ec);
+            throw;
+        }
+    }
+
+    // Session header
+    auto session_name() const -> string_t { return this->string(this->header().session_name); }
+    auto sample_rate() const noexcept -> std::uint32_t { return this->header().sample_rate; }
+    auto bit_depth() const noexcept -> std::uint32_t { return this->header().bit_depth; }
+    auto audio_clips() const noexcept -> std::uint32_t { return this->header().audio_clips; }
+    auto audio_files() const noexcept -> std::uint32_t { return this->header().audio_files; }
+    auto audio_tracks() const noexcept -> std::uint32_t { return this->header().audio_tracks; }
+    auto timecode_format() const noexcept -> timecode_fmt_t { return timecode_fmt_t(this->header().timecode_format); }
+    auto session_start() const -> timecode_t { return this->to_ticks(this->header().session_start); }
+
+    // Tracks in file order, operator[] throws std::out_of_range past the end
+    auto size() const noexcept -> size_type { return this->header().track_count; }
+
+    auto operator[](const size_type index) const -> track_view
+    {
+        if (index >= this->size()) throw std::out_of_range(fmt::format("cached track index {} out of range", index));
+        return { this, this->records<__AvidPTCacheTrack>(this->header().tracks) + index };
+    }
+
+    // Event columns over every track, track by track
+    auto event_count() const noexcept -> size_type { return this->header().event_count; }
+    auto ids() const noexcept -> std::span<const std::uint32_t> { return this->column<std::uint32_t>(this->header().ids); }
+    auto channels() const noexcept -> std::span<const std::uint32_t> { return this->column<std::uint32_t>(this->header().channels); }
+    auto start_units() const noexcept -> std::span<const units_t> { return this->column<units_t>(this->header().start_times); }
+    auto end_units() const noexcept -> std::span<const units_t> { return this->column<units_t>(this->header().end_times); }
+    auto duration_units() const noexcept -> std::span<const units_t> { return this->column<units_t>(this->header().durations); }
+
+    auto event_name(const size_type row) const -> string_t
+    {
+        return this->string(this->column<__AvidPTCacheString>(this->header().names)[row]);
+    }
+
+    auto event_state(const size_type row) const -> string_t
+    {
+        return this->string(this->column<__AvidPTCacheString>(this->header().states)[row]);
+    }
+
+    // One row of the event columns with its times as ticks
+    auto event(const size_type row) const -> event_t
+    {
+        VTM_ASSERT(row < this->event_count(), "cached event row out of range");
+
+        event_t event;
+        event.id         = this->ids()[row];
+        event.channel    = this->channels()[row];
+        event.name       = this->event_name(row);
+        event.start_time = this->to_ticks(this->start_units()[row]);
+        event.end_time   = this->to_ticks(this->end_units()[row]);
+        event.duration   = this->to_ticks(this->duration_units()[row]);
+        event.state      = this->event_state(row);
+        return event;
+    }
+
+    auto to_ticks(const units_t units) const -> timecode_t
+    {
+        return this->_format.from_units(units);
+    }
+
+    auto to_units(const timecode_t ticks) const -> units_t
+    {
+        return this->_format.to_units(ticks);
+    }
+
+private:
+    using format_t = __AvidPTTimeFormat<timecode_t>;
+
+    auto header() const noexcept -> const __AvidPTCacheHeader&
+    {
+        return *reinterpret_cast<const __AvidPTCacheHeader*>(this->_file.data());
+    }
+
+    template<typename T>
+    auto records(const std::uint64_t offset) const noexcept -> const T*
+    {
+        return reinterpret_cast<const T*>(this->_file.data() + offset);
+    }
+
+    template<typename T>
+    auto column(const std::uint64_t offset) const noexcept -> std::span<const T>
+    {
+        return { this->records<T>(offset), this->event_count() };
+    }
+
+    auto string(const __AvidPTCacheString ref) const -> string_t
+    {
+        return std::string_view(this->_file.data() + this->header().heap, this->header().heap_size).substr(ref.offset, ref.size);
+    }
+
+    // Every section inside the file and aligned, every track inside the event
+    // columns. Strings are bounds checked as they are read
+    auto valid_layout() const noexcept -> bool
+    {
+        const std::uint64_t size = this->_file.size();
+        if (size < sizeof(__AvidPTCacheHeader)) return false;
+
+        const auto& header = this->header();
+        if (header.magic != avidpt_cache_magic || header.version != avidpt_cache_version
+            || header.byte_order != avidpt_cache_byte_order || header.file_size != size) return false;
+        if (header.timecode_format < 0 || header.timecode_format >= static_cast<std::int32_t>(vtm::fps::rates.size())) return false;
+
+        const std::uint64_t rows = header.event_count;
+        const auto fits = [size](const std::uint64_t offset, const std::uint64_t count, const std::uint64_t width) {
+            return offset % 8 == 0 && offset <= size && count <= (size - offset) / width;
+        };
+        if (!fits(header.tracks, header.track_count, sizeof(__AvidPTCacheTrack))
+            || !fits(header.ids, rows, sizeof(std::uint32_t)) || !fits(header.channels, rows, sizeof(std::uint32_t))
+            || !fits(header.start_times, rows, sizeof(units_t)) || !fits(header.end_times, rows, sizeof(units_t))
+            || !fits(header.durations, rows, sizeof(units_t)) || !fits(header.names, rows, sizeof(__AvidPTCacheString))
+            || !fits(header.states, rows, sizeof(__AvidPTCacheString)) || !fits(header.heap, header.heap_size, 1)) return false;
+
+        const auto* tracks = this->records<__AvidPTCacheTrack>(header.tracks);
+        for (std::uint64_t t = 0; t < header.track_count; ++t) {
+            if (tracks[t].first_event > rows || tracks[t].event_count > rows - tracks[t].first_event) return false;
+        }
+
+        return true;
+    }
+
+private:
+    source_t _file;
+    format_t _format;
+};
+
+} // @END OF namespace vtm::edl::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm {
+
+    // Parsed Avid Pro Tools EDL session read in place from a binary cache
+    using avidpt_edl_cache = edl::internal::__AvidPTEDLCache;
+
+} // @END OF namespace vtm
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::edl {
+
+    // Opens the cache of the export at path, kept in cache_dir. A missing or
+    // stale cache is rebuilt from a full parse first, so only the first open
+    // after the export changes pays for parsing
+    inline auto open_cached(const std::string_view path, const std::string_view cache_dir) -> vtm::avidpt_edl_cache
+    {
+        const std::string source_path = internal::avidpt_absolute_path(path);
+        const std::string cache_path = internal::avidpt_cache_path(source_path, cache_dir);
+
+        vtm::avidpt_edl_cache cache;
+        if (cache.open(cache_path, source_path)) return cache;
+
+        const auto stamp = internal::__AvidPTSourceStamp::of(source_path);
+        if (!stamp) throw std::runtime_error(fmt::format("could not open file at specified path: {}", path));
+
+        vtm::avidpt_edl_view edl;
+        edl.parse_file(source_path);
+
+        std::filesystem::create_directories(std::filesystem::path(cache_dir));
+        vtm::avidpt_edl_cache::store(edl.data(), edl.source_text(), *stamp, source_path, cache_path);
+
+        if (!cache.open(cache_path, source_path))
+            throw std::runtime_error(fmt::format("file changed while it was being cached: {}", path));
+        return cache;
+    }
+
+} // @END OF namespace vtm::edl
+
+///////////////////////////////////////////////////////////////////////////
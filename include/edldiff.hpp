@@ -0,0 +1,390 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Event level differences between two Pro Tools EDL versions
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Project headers
+#include "edlfile.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __AvidPTEDLDiff --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::edl::internal {
+
+enum class __AvidPTEventChangeKind : int
+{
+    inserted, // Only in b
+    deleted,  // Only in a
+    moved,    // Same clip and duration at another time
+    trimmed,  // Same clip over an overlapping but different range
+};
+
+// One changed event. Positions are (track, event) indexes into tracks() of
+// each side, npos on the side the event is missing from. position is the
+// start of the event in b, or in a when it was deleted
+struct __AvidPTEventChange
+{
+    using timecode_t = vtm::chrono::float64_t;
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    __AvidPTEventChangeKind kind = __AvidPTEventChangeKind::inserted;
+    std::size_t track_a = npos;
+    std::size_t event_a = npos;
+    std::size_t track_b = npos;
+    std::size_t event_b = npos;
+    timecode_t position = 0.0;
+    timecode_t start_delta = 0.0; // b start less a start, moved and trimmed only
+    timecode_t end_delta = 0.0;   // b end less a end, moved and trimmed only
+};
+
+struct __AvidPTEDLDiff
+{
+    using change_t = __AvidPTEventChange;
+    using kind_t   = __AvidPTEventChangeKind;
+
+    // Tracks found on both sides as (a, b) indexes, in b order
+    std::vector<std::pair<std::size_t, std::size_t>> tracks;
+    std::vector<std::size_t> inserted_tracks;
+    std::vector<std::size_t> deleted_tracks;
+
+    // Changes of the paired tracks in b order, then the events of inserted
+    // and of deleted tracks. Within a track changes are in timeline order
+    std::vector<change_t> changes;
+    std::size_t unchanged = 0;
+
+    auto count(const kind_t kind) const noexcept -> std::size_t
+    {
+        return std::size_t(std::ranges::count(this->changes, kind, &change_t::kind));
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return this->changes.empty() && this->inserted_tracks.empty() && this->deleted_tracks.empty();
+    }
+};
+
+// @SECTION: Sort key of one event. Events are grouped by clip name, hash
+// first so most comparisons never touch the strings, then by time
+struct __AvidPTDiffKey
+{
+    using timecode_t = vtm::chrono::float64_t;
+
+    std::uint64_t hash = 0;
+    std::string_view name;
+    timecode_t start = 0.0;
+    timecode_t end = 0.0;
+    timecode_t duration = 0.0;
+    std::size_t event = 0;
+
+    auto same_name(const __AvidPTDiffKey& rhs) const noexcept -> bool
+    {
+        return this->hash == rhs.hash && this->name == rhs.name;
+    }
+
+    // Name order, then start and end
+    friend auto operator<(const __AvidPTDiffKey& lhs, const __AvidPTDiffKey& rhs) noexcept -> bool
+    {
+        return std::tie(lhs.hash, lhs.name, lhs.start, lhs.end, lhs.event) < std::tie(rhs.hash, rhs.name, rhs.start, rhs.end, rhs.event);
+    }
+};
+
+// Keys of a track's events in name order. Columnar stores are read column by
+// column instead of row by row
+template<typename TEvents>
+inline auto avidpt_diff_keys(const TEvents& events, std::vector<__AvidPTDiffKey>& out) -> void
+{
+    using timecode_t = __AvidPTDiffKey::timecode_t;
+    const std::hash<std::string_view> hash;
+
+    out.clear();
+    out.reserve(events.size());
+    if constexpr (requires { events.name(0); events.start_times(); }) {
+        const auto starts = events.start_times();
+        const auto ends = events.end_times();
+        const auto durations = events.durations();
+        for (std::size_t e = 0; e < events.size(); ++e) {
+            const std::string_view name = events.name(e);
+            out.push_back({ hash(name), name, timecode_t(starts[e]), timecode_t(ends[e]), timecode_t(durations[e]), e });
+        }
+    } else {
+        for (std::size_t e = 0; e < events.size(); ++e) {
+            const auto& event = events[e].second;
+            const std::string_view name(event.name);
+            out.push_back({ hash(name), name, event.start_time, event.end_time, event.duration, e });
+        }
+    }
+
+    std::sort(out.begin(), out.end());
+}
+
+// @SECTION: Matches the events of one pair of tracks. Both sides are sorted
+// by name, a merge walks the two lists one name at a time and matches each
+// name's events in three passes: same range, then same duration, then
+// overlapping range. What is left is inserted or deleted
+class __AvidPTTrackDiff
+{
+public:
+    using key_t    = __AvidPTDiffKey;
+    using change_t = __AvidPTEventChange;
+    using kind_t   = __AvidPTEventChangeKind;
+
+    template<typename TEvents>
+    auto run(const TEvents& a, const TEvents& b, const std::size_t track_a, const std::size_t track_b, __AvidPTEDLDiff& out) -> void
+    {
+        this->_track_a = track_a;
+        this->_track_b = track_b;
+        avidpt_diff_keys(a, this->_a);
+        avidpt_diff_keys(b, this->_b);
+
+        const std::size_t first = out.changes.size();
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < this->_a.size() || j < this->_b.size()) {
+            if (j == this->_b.size() || (i < this->_a.size() && name_less(this->_a[i], this->_b[j]))) {
+                this->deleted(this->_a[i++], out);
+            } else if (i == this->_a.size() || name_less(this->_b[j], this->_a[i])) {
+                this->inserted(this->_b[j++], out);
+            } else {
+                std::size_t ie = i + 1;
+                std::size_t je = j + 1;
+                while (ie < this->_a.size() && this->_a[ie].same_name(this->_a[i])) ++ie;
+                while (je < this->_b.size() && this->_b[je].same_name(this->_b[j])) ++je;
+                this->match(std::span(this->_a).subspan(i, ie - i), std::span(this->_b).subspan(j, je - j), out);
+                i = ie;
+                j = je;
+            }
+        }
+
+        std::sort(out.changes.begin() + std::ptrdiff_t(first), out.changes.end(), [](const change_t& lhs, const change_t& rhs) {
+            return std::tie(lhs.position, lhs.event_b, lhs.event_a) < std::tie(rhs.position, rhs.event_b, rhs.event_a);
+        });
+    }
+
+    // Every event of a track found on one side only
+    template<typename TEvents>
+    auto run_one_side(const TEvents& events, const std::size_t track, const bool from_a, __AvidPTEDLDiff& out) -> void
+    {
+        this->_track_a = from_a ? track : change_t::npos;
+        this->_track_b = from_a ? change_t::npos : track;
+        avidpt_diff_keys(events, this->_a);
+
+        const std::size_t first = out.changes.size();
+        for (const auto& key : this->_a) from_a ? this->deleted(key, out) : this->inserted(key, out);
+        std::sort(out.changes.begin() + std::ptrdiff_t(first), out.changes.end(), [](const change_t& lhs, const change_t& rhs) {
+            return std::tie(lhs.position, lhs.event_a, lhs.event_b) < std::tie(rhs.position, rhs.event_a, rhs.event_b);
+        });
+    }
+
+private:
+    static auto name_less(const key_t& lhs, const key_t& rhs) noexcept -> bool
+    {
+        return std::tie(lhs.hash, lhs.name) < std::tie(rhs.hash, rhs.name);
+    }
+
+    static auto overlaps(const key_t& a, const key_t& b) noexcept -> bool
+    {
+        return a.start < b.end && b.start < a.end;
+    }
+
+    // Events of one name on each side, both in (start, end) order
+    auto match(const std::span<const key_t> a, const std::span<const key_t> b, __AvidPTEDLDiff& out) -> void
+    {
+        // Same range, a merge over the (start, end) order both sides share
+        this->_left_a.clear();
+        this->_left_b.clear();
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i].start == b[j].start && a[i].end == b[j].end) {
+                ++out.unchanged;
+                ++i;
+                ++j;
+            } else if (std::tie(a[i].start, a[i].end) < std::tie(b[j].start, b[j].end)) {
+                this->_left_a.push_back(&a[i++]);
+            } else {
+                this->_left_b.push_back(&b[j++]);
+            }
+        }
+        for (; i < a.size(); ++i) this->_left_a.push_back(&a[i]);
+        for (; j < b.size(); ++j) this->_left_b.push_back(&b[j]);
+        if (this->_left_a.empty() && this->_left_b.empty()) return;
+
+        // Same duration elsewhere, paired in start order
+        const auto by_duration = [](const key_t* lhs, const key_t* rhs) {
+            return std::tie(lhs->duration, lhs->start) < std::tie(rhs->duration, rhs->start);
+        };
+        std::ranges::sort(this->_left_a, by_duration);
+        std::ranges::sort(this->_left_b, by_duration);
+        this->_rest_a.clear();
+        this->_rest_b.clear();
+        i = 0;
+        j = 0;
+        while (i < this->_left_a.size() && j < this->_left_b.size()) {
+            const key_t* ka = this->_left_a[i];
+            const key_t* kb = this->_left_b[j];
+            if (ka->duration == kb->duration) {
+                this->paired(kind_t::moved, *ka, *kb, out);
+                ++i;
+                ++j;
+            } else if (ka->duration < kb->duration) {
+                this->_rest_a.push_back(ka);
+                ++i;
+            } else {
+                this->_rest_b.push_back(kb);
+                ++j;
+            }
+        }
+        for (; i < this->_left_a.size(); ++i) this->_rest_a.push_back(this->_left_a[i]);
+        for (; j < this->_left_b.size(); ++j) this->_rest_b.push_back(this->_left_b[j]);
+
+        // Overlapping ranges, a sweep in start order
+        const auto by_start = [](const key_t* lhs, const key_t* rhs) {
+            return std::tie(lhs->start, lhs->end) < std::tie(rhs->start, rhs->end);
+        };
+        std::ranges::sort(this->_rest_a, by_start);
+        std::ranges::sort(this->_rest_b, by_start);
+        i = 0;
+        j = 0;
+        while (i < this->_rest_a.size() && j < this->_rest_b.size()) {
+            const key_t* ka = this->_rest_a[i];
+            const key_t* kb = this->_rest_b[j];
+            if (overlaps(*ka, *kb)) {
+                this->paired(kind_t::trimmed, *ka, *kb, out);
+                ++i;
+                ++j;
+            } else if (ka->end <= kb->start) {
+                this->deleted(*ka, out);
+                ++i;
+            } else {
+                this->inserted(*kb, out);
+                ++j;
+            }
+        }
+        for (; i < this->_rest_a.size(); ++i) this->deleted(*this->_rest_a[i], out);
+        for (; j < this->_rest_b.size(); ++j) this->inserted(*this->_rest_b[j], out);
+    }
+
+    auto paired(const kind_t kind, const key_t& a, const key_t& b, __AvidPTEDLDiff& out) const -> void
+    {
+        out.changes.push_back({ kind, this->_track_a, a.event, this->_track_b, b.event, b.start, b.start - a.start, b.end - a.end });
+    }
+
+    auto inserted(const key_t& b, __AvidPTEDLDiff& out) const -> void
+    {
+        out.changes.push_back({ kind_t::inserted, change_t::npos, change_t::npos, this->_track_b, b.event, b.start, 0.0, 0.0 });
+    }
+
+    auto deleted(const key_t& a, __AvidPTEDLDiff& out) const -> void
+    {
+        out.changes.push_back({ kind_t::deleted, this->_track_a, a.event, change_t::npos, change_t::npos, a.start, 0.0, 0.0 });
+    }
+
+private:
+    std::size_t _track_a = 0;
+    std::size_t _track_b = 0;
+
+    // Reused from track to track
+    std::vector<key_t> _a;
+    std::vector<key_t> _b;
+    std::vector<const key_t*> _left_a;
+    std::vector<const key_t*> _left_b;
+    std::vector<const key_t*> _rest_a;
+    std::vector<const key_t*> _rest_b;
+};
+
+// Tracks are paired by name, the k-th track of a name in a with the k-th of
+// that name in b
+template<typename TTracks>
+inline auto avidpt_diff_tracks(const TTracks& a, const TTracks& b, __AvidPTEDLDiff& out) -> void
+{
+    const auto sorted = [](const TTracks& tracks) {
+        std::vector<std::pair<std::string_view, std::size_t>> names;
+        names.reserve(tracks.size());
+        for (std::size_t t = 0; t < tracks.size(); ++t) names.emplace_back(std::string_view(tracks[t].second.name), t);
+        std::ranges::sort(names);
+        return names;
+    };
+
+    const auto na = sorted(a);
+    const auto nb = sorted(b);
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < na.size() || j < nb.size()) {
+        if (j == nb.size() || (i < na.size() && na[i].first < nb[j].first)) {
+            out.deleted_tracks.push_back(na[i++].second);
+        } else if (i == na.size() || nb[j].first < na[i].first) {
+            out.inserted_tracks.push_back(nb[j++].second);
+        } else {
+            out.tracks.emplace_back(na[i++].second, nb[j++].second);
+        }
+    }
+
+    std::ranges::sort(out.tracks, {}, &std::pair<std::size_t, std::size_t>::second);
+    std::ranges::sort(out.inserted_tracks);
+    std::ranges::sort(out.deleted_tracks);
+}
+
+} // @END OF namespace vtm::edl::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm {
+
+    // Event changes between two versions of an Avid Pro Tools EDL session
+    using avidpt_edl_diff = edl::internal::__AvidPTEDLDiff;
+
+} // @END OF namespace vtm
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::edl {
+
+    using event_change_kind = internal::__AvidPTEventChangeKind;
+
+    // Changes that turn the track listing of a into that of b. Tracks are
+    // aligned by name and their events by clip name and time, an event with
+    // the same clip, start and end on both sides is unchanged. Both sides are
+    // sorted and merged, O(n log n) in the event count. Parses the track
+    // listing of either side on first access
+    template<typename TEDL>
+    auto diff(const TEDL& a, const TEDL& b) -> vtm::avidpt_edl_diff
+    {
+        const auto& tracks_a = a.tracks();
+        const auto& tracks_b = b.tracks();
+
+        vtm::avidpt_edl_diff out;
+        internal::avidpt_diff_tracks(tracks_a, tracks_b, out);
+
+        internal::__AvidPTTrackDiff track_diff;
+        for (const auto& [ta, tb] : out.tracks) track_diff.run(tracks_a[ta].second.events, tracks_b[tb].second.events, ta, tb, out);
+        for (const std::size_t tb : out.inserted_tracks) track_diff.run_one_side(tracks_b[tb].second.events, tb, false, out);
+        for (const std::size_t ta : out.deleted_tracks) track_diff.run_one_side(tracks_a[ta].second.events, ta, true, out);
+
+        return out;
+    }
+
+} // @END OF namespace vtm::edl
+
+///////////////////////////////////////////////////////////////////////////
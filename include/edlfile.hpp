@@ -6,20 +6,37 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // Standard library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <functional>
 #include <iterator>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 // Project library
 #include "errors.hpp"
+#include "file_reader.hpp"
+#include "file_writer.hpp"
+#include "mapped_file.hpp"
+#include "string_arena.hpp"
+#include "thread_pool.hpp"
 #include "timecode.hpp"
 #include "traits.hpp"
 #include "utility.hpp"
@@ -45,6 +62,29 @@
                                                   "P L U G - I N S  L I S T I N G",                  \
                                                   "T R A C K  L I S T I N G")
 
+#define __AVIDPTEDL_FPS_TO_STRING(in) GET_ENUM_MAPPING_1(__AVIDPTEDL_FPS_STRING(), in)
+#define __AVIDPTEDL_STRING_TO_FPS(in) GET_ENUM_MAPPING_2(__AVIDPTEDL_FPS_STRING(), in)
+#define __AVIDPTEDL_FPS_STRING() DECLARE_ENUM_MAPPING(vtm::fps::type,                                    \
+                                                      std::string_view,                                  \
+                                                      []() { VTM_WARN("unknown Avid PT timecode format"); }, \
+                                                      []() { VTM_WARN("unknown Avid PT timecode format"); }, \
+                                                      vtm::fps::none,                                    \
+                                                      "NONE",                                            \
+                                                      "24 Frame",                                        \
+                                                      "25 Frame",                                        \
+                                                      "30 Frame",                                        \
+                                                      "29.97 Frame",                                     \
+                                                      "29.97 Drop Frame",                                \
+                                                      "60 Frame",                                        \
+                                                      "23.976 Frame",                                    \
+                                                      "48 Frame",                                        \
+                                                      "50 Frame",                                        \
+                                                      "59.94 Frame",                                     \
+                                                      "59.94 Drop Frame",                                \
+                                                      "100 Frame",                                       \
+                                                      "119.88 Frame",                                    \
+                                                      "120 Frame")
+
 #endif // @END OF VTM_EDLFILE_MACROS
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,32 +174,293 @@ struct __AvidPTTrackEvent : public vtm::traits::__clear
     using timecode_t = vtm::chrono::float64_t;
 
     // Virtual interfaces
-    void clear() noexcept;
+    void clear() noexcept
+    {
+        id = 0;
+        channel = 0;
+        name = string_t{};
+        start_time = 0.0;
+        end_time = 0.0;
+        duration = 0.0;
+        state = string_t{};
+    }
 
-    uint32_t id;
-    uint32_t channel;
+    uint32_t id = 0;
+    uint32_t channel = 0;
     string_t name;
-    timecode_t start_time;
-    timecode_t end_time;
-    timecode_t duration;
+    timecode_t start_time = 0.0;
+    timecode_t end_time = 0.0;
+    timecode_t duration = 0.0;
     string_t state;
 };
 
+// One row of the markers listing
+template<typename Tstring, typename _Tstring = std::remove_cvref_t<Tstring>>
+struct __AvidPTMarker : public vtm::traits::__clear
+{
+    using string_t   = _Tstring;
+    using timecode_t = vtm::chrono::float64_t;
+
+    void clear() noexcept
+    {
+        id = 0;
+        location = 0.0;
+        time_reference = 0;
+        units = string_t{};
+        name = string_t{};
+        comments = string_t{};
+    }
+
+    uint32_t id = 0;
+    timecode_t location = 0.0;
+    uint64_t time_reference = 0;
+    string_t units;
+    string_t name;
+    string_t comments;
+};
+
+// Session header fields, as streamed before the first section
+template<typename Tstring, typename _Tstring = std::remove_cvref_t<Tstring>>
+struct __AvidPTSessionHeader : public vtm::traits::__clear
+{
+    using string_t       = _Tstring;
+    using timecode_t     = vtm::chrono::float64_t;
+    using timecode_fmt_t = typename vtm::fps::type;
+
+    void clear() noexcept
+    {
+        session_name = string_t{};
+        sample_rate = 0;
+        bit_depth = 0;
+        audio_clips = 0;
+        audio_files = 0;
+        audio_tracks = 0;
+        session_start = 0.0;
+        timecode_format = vtm::fps::none;
+    }
+
+    string_t session_name;
+    uint32_t sample_rate = 0;
+    uint32_t bit_depth = 0;
+    uint32_t audio_clips = 0;
+    uint32_t audio_files = 0;
+    uint32_t audio_tracks = 0;
+    timecode_t session_start = 0.0;
+    timecode_fmt_t timecode_format = vtm::fps::none;
+};
+
+// Track STATE flags, unknown words in the export are ignored
+enum class __AvidPTTrackState : std::uint64_t
+{
+    none     = 0,
+    inactive = 1 << 0,
+    hidden   = 1 << 1,
+    muted    = 1 << 2,
+    solo     = 1 << 3,
+};
+
+// @SECTION: Events of one track stored column by column. Ids, channels and
+// the three timecodes each get their own array, timecodes narrowed to at most
+// 8 bytes so scans fill vector lanes. Names and states are offsets into one
+// string heap per track. Rows read back as (index, event) pairs by value,
+// their strings view the heap and stay valid until the store is modified
+template<vtm::traits::StringLike TView = std::string_view>
+class __AvidPTEventStore
+{
+public:
+    using string_t     = std::remove_cvref_t<TView>;
+    using event_t      = __AvidPTTrackEvent<string_t>;
+    using value_type   = std::pair<std::size_t, event_t>;
+    using timecode_t   = typename event_t::timecode_t;
+    using storage_type = std::conditional_t<(sizeof(timecode_t) > 8), double, timecode_t>;
+    using size_type    = std::size_t;
+
+    // Heap location of one string
+    struct string_ref
+    {
+        std::uint32_t offset = 0;
+        std::uint32_t size = 0;
+    };
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = __AvidPTEventStore::value_type;
+        using difference_type   = std::ptrdiff_t;
+
+        const_iterator() = default;
+        const_iterator(const __AvidPTEventStore* store, const size_type i) noexcept : _store(store), _i(i) {}
+
+        auto operator*() const -> value_type { return (*this->_store)[this->_i]; }
+        auto operator++() noexcept -> const_iterator& { ++this->_i; return *this; }
+        auto operator++(int) noexcept -> const_iterator { const_iterator it = *this; ++this->_i; return it; }
+        bool operator==(const const_iterator&) const = default;
+
+    private:
+        const __AvidPTEventStore* _store = nullptr;
+        size_type _i = 0;
+    };
+
+    void clear() noexcept
+    {
+        this->_ids.clear();
+        this->_channels.clear();
+        this->_start_times.clear();
+        this->_end_times.clear();
+        this->_durations.clear();
+        this->_names.clear();
+        this->_states.clear();
+        this->_heap.clear();
+    }
+
+    auto size() const noexcept -> size_type { return this->_ids.size(); }
+    auto empty() const noexcept -> bool { return this->_ids.empty(); }
+
+    auto reserve(const size_type n) -> void
+    {
+        this->_ids.reserve(n);
+        this->_channels.reserve(n);
+        this->_start_times.reserve(n);
+        this->_end_times.reserve(n);
+        this->_durations.reserve(n);
+        this->_names.reserve(n);
+        this->_states.reserve(n);
+    }
+
+    // Rows are stored in order, index must be size()
+    auto emplace_back(const size_type index, const event_t& event) -> void
+    {
+        VTM_ASSERT(index == this->size(), "event store rows must be appended in order");
+        this->push_back(event);
+    }
+
+    auto push_back(const event_t& event) -> void
+    {
+        this->_ids.push_back(event.id);
+        this->_channels.push_back(event.channel);
+        this->_start_times.push_back(static_cast<storage_type>(event.start_time));
+        this->_end_times.push_back(static_cast<storage_type>(event.end_time));
+        this->_durations.push_back(static_cast<storage_type>(event.duration));
+        this->_names.push_back(this->store(event.name));
+
+        // Consecutive rows mostly share a state, which is then stored once
+        const bool repeated = !this->_states.empty() && this->string(this->_states.back()) == std::string_view(event.state);
+        this->_states.push_back(repeated ? this->_states.back() : this->store(event.state));
+    }
+
+    auto operator[](const size_type i) const -> value_type
+    {
+        VTM_ASSERT(i < this->size(), "event store index out of range");
+
+        event_t event;
+        event.id         = this->_ids[i];
+        event.channel    = this->_channels[i];
+        event.name       = this->name(i);
+        event.start_time = this->_start_times[i];
+        event.end_time   = this->_end_times[i];
+        event.duration   = this->_durations[i];
+        event.state      = this->state(i);
+        return { i, event };
+    }
+
+    auto begin() const noexcept -> const_iterator { return { this, 0 }; }
+    auto end() const noexcept -> const_iterator { return { this, this->size() }; }
+
+    // Column access
+    auto ids() const noexcept -> std::span<const std::uint32_t> { return this->_ids; }
+    auto channels() const noexcept -> std::span<const std::uint32_t> { return this->_channels; }
+    auto start_times() const noexcept -> std::span<const storage_type> { return this->_start_times; }
+    auto end_times() const noexcept -> std::span<const storage_type> { return this->_end_times; }
+    auto durations() const noexcept -> std::span<const storage_type> { return this->_durations; }
+    auto name(const size_type i) const noexcept -> string_t { return string_t(this->string(this->_names[i])); }
+    auto state(const size_type i) const noexcept -> string_t { return string_t(this->string(this->_states[i])); }
+    auto heap() const noexcept -> std::string_view { return this->_heap; }
+
+    // Earliest start and latest end of a non-empty store
+    auto extent() const -> std::pair<timecode_t, timecode_t>
+    {
+        VTM_ASSERT(!this->empty(), "extent() called on an empty event store");
+        return { timecode_t(vtm::chrono::internal::column_minmax(this->start_times()).first),
+                 timecode_t(vtm::chrono::internal::column_minmax(this->end_times()).second) };
+    }
+
+    auto total_duration() const noexcept -> timecode_t
+    {
+        return timecode_t(vtm::chrono::internal::column_sum(this->durations()));
+    }
+
+    // Appends the index of every event overlapping [lo, hi), in row order
+    auto overlapping(const timecode_t lo, const timecode_t hi, std::vector<size_type>& out) const -> void
+    {
+        vtm::chrono::internal::column_overlaps(this->start_times(), this->end_times(),
+                                               static_cast<storage_type>(lo), static_cast<storage_type>(hi), out);
+    }
+
+private:
+    auto store(const std::string_view s) -> string_ref
+    {
+        VTM_ASSERT(this->_heap.size() + s.size() <= UINT32_MAX, "event store string heap exceeds 4 GiB");
+        const string_ref ref{ std::uint32_t(this->_heap.size()), std::uint32_t(s.size()) };
+        this->_heap.append(s);
+        return ref;
+    }
+
+    auto string(const string_ref ref) const noexcept -> std::string_view
+    {
+        return std::string_view(this->_heap).substr(ref.offset, ref.size);
+    }
+
+private:
+    std::vector<std::uint32_t> _ids;
+    std::vector<std::uint32_t> _channels;
+    std::vector<storage_type> _start_times;
+    std::vector<storage_type> _end_times;
+    std::vector<storage_type> _durations;
+    std::vector<string_ref> _names;
+    std::vector<string_ref> _states;
+    std::string _heap;
+};
+
+// Type event times are kept in by TEvents, narrowed by an event store
+template<typename TEvents>
+struct __AvidPTStoredTime
+{
+    using type = typename TEvents::value_type::second_type::timecode_t;
+};
+
+template<typename TEvents>
+    requires requires { typename TEvents::storage_type; }
+struct __AvidPTStoredTime<TEvents>
+{
+    using type = typename TEvents::storage_type;
+};
+
 // TODO: EDLTrackDataInterface concept
 template<typename T>
 concept EDLTrackDataInterface = true;
 
-template<typename Tstring = std::string, typename _Tstring = std::remove_cvref_t<Tstring>>
+// TEvents holds (index, event) rows, a vector of pairs or an event store
+template<typename Tstring = std::string,
+         typename _Tstring = std::remove_cvref_t<Tstring>,
+         typename TEvents = std::vector<std::pair<std::size_t, __AvidPTTrackEvent<_Tstring>>>>
 struct __AvidPTTrack : public vtm::traits::__clear
 {
     using string_t          = _Tstring;
-    using event_t           = __AvidPTTrackEvent<string_t>;
-    using data_t            = std::vector<std::pair<std::size_t, event_t>>;
+    using data_t            = TEvents;
+    using event_t           = typename data_t::value_type::second_type;
     using timeline_format_t = TimelineUnitFormat;
 
     
     // Virtual interfaces
-    void clear() noexcept;
+    void clear() noexcept
+    {
+        name = string_t{};
+        comments = string_t{};
+        delay = user_delay{};
+        state = 0;
+        events.clear();
+    }
 
     // Accessor methods
     event_t operator[](std::size_t index);
@@ -169,11 +470,12 @@ struct __AvidPTTrack : public vtm::traits::__clear
     string_t comments;
 
     struct user_delay {
-        uint32_t delay;
-        timeline_format_t unit;
+        uint32_t delay = 0;
+        timeline_format_t unit = timeline_format_t::samples;
     };
 
-    uint64_t state;
+    user_delay delay{};
+    uint64_t state = 0;
     data_t events;
 };
 
@@ -215,12 +517,13 @@ concept EDLDataInterface =
     };
 
 template<vtm::traits::StringLike TString,
-         vtm::traits::StringLike TView>
+         vtm::traits::StringLike TView,
+         typename TTrack = __AvidPTTrack<std::remove_cvref_t<TString>>>
 struct __AvidPTEDLData
 {
     using string_t = std::remove_cvref_t<TString>;
     using string_view_t = std::remove_cvref_t<TView>;
-    using track_t  = __AvidPTTrack<string_t>;
+    using track_t  = TTrack;
     using event_t  = typename track_t::event_t;
     using data_t   = std::vector<std::pair<std::size_t, track_t>>; // TODO: template for container type
     using timecode_t = vtm::chrono::float64_t;
@@ -234,123 +537,1940 @@ struct __AvidPTEDLData
     __AvidPTEDLData& operator=(__AvidPTEDLData&& edlfile) noexcept = delete;
     bool operator==(const __AvidPTEDLData&) const = delete;
 
+    void clear() noexcept
+    {
+        session_name = string_t{};
+        sample_rate = 0;
+        bit_depth = 0;
+        audio_clips = 0;
+        audio_files = 0;
+        audio_tracks = 0;
+        session_start = 0.0;
+        timecode_format = vtm::fps::none;
+        tracks.clear();
+    }
+
     // Data members
     string_t session_name;
-    uint32_t sample_rate;
-    uint32_t bit_depth;
-    uint32_t audio_clips;
-    uint32_t audio_files;
-    uint32_t audio_tracks;
-    timecode_t session_start;
-    timecode_fmt_t timecode_format;
+    uint32_t sample_rate = 0;
+    uint32_t bit_depth = 0;
+    uint32_t audio_clips = 0;
+    uint32_t audio_files = 0;
+    uint32_t audio_tracks = 0;
+    timecode_t session_start = 0.0;
+    timecode_fmt_t timecode_format = vtm::fps::none;
     data_t tracks;
 };
 
-template< vtm::traits::StringLike TString = std::string,
-          vtm::traits::StringLike TView = std::string_view,
-          EDLFileCompatible Interface = EDLFile<TString, TView>,
-          EDLDataInterface TData = internal::__AvidPTEDLData<typename Interface::string_t, typename Interface::string_view_t> >
-class __AvidPTEDLFile : public Interface
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Avid Pro Tools EDL Parsing --
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// @SECTION: Line and field scanning over the raw text. Fields are tab separated
+// and padded with spaces, returned views point into the scanned text
+
+// Next line without its terminator, LF and CRLF endings are accepted
+inline auto avidpt_next_line(std::string_view& text) noexcept -> std::string_view
 {
-public:
-    using string_t      = typename Interface::string_t;
-    using string_view_t = typename Interface::string_view_t;
-    using display_t     = typename Interface::display_t;
-    using data_t        = std::remove_cvref_t<TData>;
-    using track_t       = typename data_t::track_t;
-    using event_t       = typename data_t::event_t;
+    const char* nl = static_cast<const char*>(std::memchr(text.data(), '\n', text.size()));
+    const std::size_t length = nl ? std::size_t(nl - text.data()) : text.size();
 
-    __AvidPTEDLFile() = default;
-    ~__AvidPTEDLFile() = default;
-    __AvidPTEDLFile(const __AvidPTEDLFile& edl_file) = default;
-    __AvidPTEDLFile(__AvidPTEDLFile&& edl_file) noexcept = default;
-    __AvidPTEDLFile& operator=(const __AvidPTEDLFile& edl_file) = default;
-    __AvidPTEDLFile& operator=(__AvidPTEDLFile&& edl_file) noexcept = default;
+    std::string_view line = text.substr(0, length);
+    text.remove_prefix(nl ? length + 1 : length);
 
-    // Path constructors
-    explicit __AvidPTEDLFile(const string_view_t& path) noexcept
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    return line;
+}
+
+inline auto avidpt_trim(std::string_view s) noexcept -> std::string_view
+{
+    while (!s.empty() && (s.front() == ' ' || s.front() == '\t')) s.remove_prefix(1);
+    while (!s.empty() && (s.back() == ' ' || s.back() == '\t')) s.remove_suffix(1);
+    return s;
+}
+
+// Next tab separated field of a line, trimmed
+inline auto avidpt_next_field(std::string_view& line) noexcept -> std::string_view
+{
+    const char* tab = static_cast<const char*>(std::memchr(line.data(), '\t', line.size()));
+    const std::size_t length = tab ? std::size_t(tab - line.data()) : line.size();
+
+    const std::string_view field = line.substr(0, length);
+    line.remove_prefix(tab ? length + 1 : length);
+    return avidpt_trim(field);
+}
+
+// Value of a "KEY:\tvalue" line if the line starts with key, otherwise false
+inline auto avidpt_key_value(std::string_view line, std::string_view key, std::string_view& value) noexcept -> bool
+{
+    if (!line.starts_with(key)) return false;
+    value = avidpt_trim(line.substr(key.size()));
+    return true;
+}
+
+// Section of a banner line such as "T R A C K  L I S T I N G", none for any
+// other line. Banners are letters spaced out, so most lines fail on byte 1
+inline auto avidpt_section_of(std::string_view line) noexcept -> __AvidPTEDLSection
+{
+    line = avidpt_trim(line);
+    if (line.size() < 3 || line[1] != ' ' || line[0] < 'A' || line[0] > 'Z') return __AvidPTEDLSection::none;
+
+    for (const auto section : magic_enum::enum_values<__AvidPTEDLSection>()) {
+        if (section == __AvidPTEDLSection::header || section == __AvidPTEDLSection::none) continue;
+        if (line == __AVIDPTEDL_VALUE_TO_STRING(section)) return section;
+    }
+
+    return __AvidPTEDLSection::none;
+}
+
+template<std::unsigned_integral T>
+inline auto avidpt_to_unsigned(const std::string_view field, const std::size_t line) -> T
+{
+    T value = 0;
+    const auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+    if (ec != std::errc{} || ptr == field.data())
+        throw std::runtime_error(fmt::format("line {}: expected an unsigned number, found '{}'", line, field));
+
+    return value;
+}
+
+// @SECTION: Session time format, resolved once from the header and used to
+// convert every event time in place
+template<std::floating_point F>
+struct __AvidPTTimeFormat
+{
+    using float_type = F;
+
+    vtm::fps::type fps = vtm::fps::none;
+    F fps_float = 0.0;
+    bool drop_frame = false;
+    std::uint64_t nominal = 0;
+    std::array<F, 4> coefs{};
+    F sample_rate = 0.0;
+
+    static auto from_session(const vtm::fps::type fps, const std::uint32_t sample_rate) -> __AvidPTTimeFormat
     {
-        try {
-            this->parse_file(path);
-        } catch (const std::runtime_error& e) {
-            VTM_WARN(e.what());
+        __AvidPTTimeFormat format;
+        format.sample_rate = F(sample_rate);
+        if (fps == vtm::fps::none) return format;
+
+        format.fps = fps;
+        format.fps_float = F(vtm::fps::to_float(fps));
+        format.drop_frame = vtm::fps::is_drop_frame(fps);
+        format.nominal = static_cast<std::uint64_t>(vtm::fps::to_nominal(fps));
+        format.coefs = vtm::chrono::fps_to_ticks_by_chunk(format.fps_float);
+        return format;
+    }
+
+    // "HH:MM:SS:FF", "HH:MM:SS;FF" with an optional ".SS" subframe suffix, or a
+    // plain sample count when the session was exported in samples
+    auto to_ticks(const std::string_view field, const std::size_t line) const -> F
+    {
+        if (field.size() >= VTM_TCSTRING_FIXED_SIZE && field[2] == ':') {
+            if (this->fps == vtm::fps::none)
+                throw std::runtime_error(fmt::format("line {}: timecode '{}' found before a supported TIMECODE FORMAT", line, field));
+
+            vtm::chrono::tcstring_fields fields;
+            if (!vtm::chrono::parse_tcstring_fixed(field.data(), fields))
+                throw std::runtime_error(fmt::format("line {}: invalid timecode '{}'", line, field));
+
+            F ticks = 0.0;
+            if (this->drop_frame) {
+                if (!vtm::chrono::valid_dropframe_fields(fields, this->nominal))
+                    throw std::runtime_error(fmt::format("line {}: invalid drop-frame timecode '{}'", line, field));
+                ticks = vtm::chrono::dropframe_fields_to_ticks(fields, this->fps_float);
+            } else {
+                ticks = vtm::chrono::fields_to_ticks(fields, this->coefs);
+            }
+
+            if (field.size() > VTM_TCSTRING_FIXED_SIZE) {
+                if (field[VTM_TCSTRING_FIXED_SIZE] != '.')
+                    throw std::runtime_error(fmt::format("line {}: invalid timecode '{}'", line, field));
+                const auto subframes = avidpt_to_unsigned<std::uint32_t>(field.substr(VTM_TCSTRING_FIXED_SIZE + 1), line);
+                ticks += F(subframes) / F(100.0) * this->coefs[3];
+            }
+
+            return ticks;
+        }
+
+        if (this->sample_rate > F(0.0)) {
+            const auto samples = avidpt_to_unsigned<std::uint64_t>(field, line);
+            return F(samples) / this->sample_rate / F(100.0);
         }
+
+        throw std::runtime_error(fmt::format("line {}: unsupported time value '{}'", line, field));
     }
 
-public:
-    // Virtual interfaces
-    void parse_file(const string_view_t& path)
+    // Longest text format_to() writes, a 20 digit sample count
+    static constexpr std::size_t max_chars = 20;
+
+    // Inverse of to_ticks(). A time between two frames gets the ".SS" subframe
+    // suffix, sessions without a timecode format are written in samples
+    auto format_to(char* out, const F ticks) const -> char*
     {
-        // Get size of file & reset position
-        std::ifstream file(path.data(), std::ios::binary | std::ios::ate);
+        if (this->fps == vtm::fps::none) {
+            return std::to_chars(out, out + max_chars, this->to_samples(ticks)).ptr;
+        }
 
-        if (!file)
-            throw std::runtime_error(fmt::format("could not open file at specified path: {}", path));
+        const auto [fields, subframes] = this->split(ticks);
+        out = vtm::chrono::format_tcstring_fixed(out, fields);
 
-        const std::size_t file_length = file.tellg();
-        file.seekg(0);
+        if (subframes > 0) {
+            *out++ = '.';
+            vtm::chrono::internal::write_digit_pair(out, subframes);
+            out += 2;
+        }
 
+        return out;
     }
 
-    void write_file(const string_view_t& path) const
+    // Integer form of a time, exact for every time to_ticks() returns. Samples
+    // for sessions without a timecode format, otherwise hundredths of a frame
+    // counted along the labels from 00:00:00:00, so ordering is kept and
+    // from_units() recomputes the ticks the text would have parsed to
+    auto to_units(const F ticks) const -> std::int64_t
     {
-        VTM_TODO("not implemented");
+        if (this->fps == vtm::fps::none) return static_cast<std::int64_t>(this->to_samples(ticks));
+
+        const auto [fields, subframes] = this->split(ticks);
+        const std::uint64_t seconds = (std::uint64_t(fields.hours) * 60 + fields.minutes) * 60 + fields.seconds;
+        return static_cast<std::int64_t>((seconds * this->nominal + fields.frames) * 100 + subframes);
     }
 
-    virtual auto clear() noexcept -> void
+    auto from_units(const std::int64_t units) const -> F
     {
-        VTM_TODO("not implemented");
+        if (this->fps == vtm::fps::none) {
+            return this->sample_rate > F(0.0) ? F(units) / this->sample_rate / F(100.0) : F(0.0);
+        }
+
+        const auto value = static_cast<std::uint64_t>(units);
+        const std::uint64_t frames = value / 100;
+        const std::uint64_t seconds = frames / this->nominal;
+
+        vtm::chrono::tcstring_fields fields;
+        fields.hours   = static_cast<std::uint32_t>(seconds / 3600);
+        fields.minutes = static_cast<std::uint32_t>(seconds / 60 % 60);
+        fields.seconds = static_cast<std::uint32_t>(seconds % 60);
+        fields.frames  = static_cast<std::uint32_t>(frames % this->nominal);
+
+        F ticks = this->drop_frame ? vtm::chrono::dropframe_fields_to_ticks(fields, this->fps_float)
+                                   : vtm::chrono::fields_to_ticks(fields, this->coefs);
+        if (const std::uint64_t subframes = value % 100; subframes > 0) ticks += F(subframes) / F(100.0) * this->coefs[3];
+        return ticks;
     }
-    
-    virtual auto display() const noexcept -> display_t
+
+private:
+    auto to_samples(const F ticks) const -> std::uint64_t
     {
-        VTM_TODO("not implemented");
+        return static_cast<std::uint64_t>(std::max(F(0.0), ticks * F(100.0) * this->sample_rate + F(0.5)));
     }
-    
-    // Member access
-    track_t get_track(const std::string_view& name)
+
+    // Frame label of a time and its subframes past the label, 0 when the time
+    // is within half a subframe of the label
+    auto split(const F ticks) const -> std::pair<vtm::chrono::tcstring_fields, std::uint32_t>
     {
-        VTM_TODO("not implemented");
+        // Backing off just under half a frame lands the rounding of
+        // ticks_to_fields() on the frame a subframe suffix was added to
+        const F frame = this->coefs[3];
+        const auto fields = vtm::chrono::ticks_to_fields(std::max(F(0.0), ticks - frame * F(0.495)), this->fps_float, this->drop_frame);
+        const F label = this->drop_frame ? vtm::chrono::dropframe_fields_to_ticks(fields, this->fps_float)
+                                         : vtm::chrono::fields_to_ticks(fields, this->coefs);
+
+        const F subframes = (ticks - label) / frame * F(100.0);
+        if (subframes >= F(0.5) && subframes < F(99.5)) return { fields, static_cast<std::uint32_t>(subframes + F(0.5)) };
+        return { fields, 0 };
     }
+};
 
-    track_t& get_track(const std::string_view& name) const
+// @SECTION: Column positions of an event row, taken from the CHANNEL header row
+// of each track. Exports with a TIMESTAMP column shift the later columns
+struct __AvidPTEventColumns
+{
+    static constexpr std::size_t missing = 0xff;
+    static constexpr std::size_t max_fields = 16;
+
+    std::size_t channel  = 0;
+    std::size_t event    = 1;
+    std::size_t name     = 2;
+    std::size_t start    = 3;
+    std::size_t end      = 4;
+    std::size_t duration = 5;
+    std::size_t state    = 6;
+
+    static auto from_header(std::string_view line) noexcept -> __AvidPTEventColumns
     {
-        VTM_TODO("not implemented");
+        __AvidPTEventColumns columns{ missing, missing, missing, missing, missing, missing, missing };
+        for (std::size_t i = 0; !line.empty() && i < max_fields; ++i) {
+            const std::string_view field = avidpt_next_field(line);
+            if (field == "CHANNEL")         columns.channel = i;
+            else if (field == "EVENT")      columns.event = i;
+            else if (field == "CLIP NAME")  columns.name = i;
+            else if (field == "START TIME") columns.start = i;
+            else if (field == "END TIME")   columns.end = i;
+            else if (field == "DURATION")   columns.duration = i;
+            else if (field == "STATE")      columns.state = i;
+        }
+
+        return columns;
     }
+};
+
+// @SECTION: Column positions of a marker row, taken from the "#" header row of
+// the markers listing. Newer exports add TRACK NAME and TRACK TYPE columns
+struct __AvidPTMarkerColumns
+{
+    static constexpr std::size_t missing = __AvidPTEventColumns::missing;
+    static constexpr std::size_t max_fields = __AvidPTEventColumns::max_fields;
+
+    std::size_t id             = 0;
+    std::size_t location       = 1;
+    std::size_t time_reference = 2;
+    std::size_t units          = 3;
+    std::size_t name           = 4;
+    std::size_t comments       = 5;
 
-    track_t operator[](std::size_t index)
+    static auto from_header(std::string_view line) noexcept -> __AvidPTMarkerColumns
     {
-        VTM_TODO("not implemented");
+        __AvidPTMarkerColumns columns{ missing, missing, missing, missing, missing, missing };
+        for (std::size_t i = 0; !line.empty() && i < max_fields; ++i) {
+            const std::string_view field = avidpt_next_field(line);
+            if (field == "#")                   columns.id = i;
+            else if (field == "LOCATION")       columns.location = i;
+            else if (field == "TIME REFERENCE") columns.time_reference = i;
+            else if (field == "UNITS")          columns.units = i;
+            else if (field == "NAME")           columns.name = i;
+            else if (field == "COMMENTS")       columns.comments = i;
+        }
+
+        return columns;
+    }
+};
+
+// @SECTION: Calls on_candidate(position, line) for every line starting with an
+// uppercase letter followed by a space, the shape of a section banner. Event
+// rows start with digits and keyed lines with words, so candidates are rare
+// and the scan is bound by the newline search
+template<typename F>
+inline auto avidpt_scan_banner_candidates(const std::string_view text, F&& on_candidate) -> void
+{
+    const char* data = text.data();
+    const std::size_t n = text.size();
+    std::size_t line = 1;
+
+    const auto check = [&](const std::size_t start, const std::size_t start_line) {
+        if (start + 1 < n && data[start] >= 'A' && data[start] <= 'Z' && data[start + 1] == ' ') on_candidate(start, start_line);
+    };
+
+    check(0, line);
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    // Newline at byte k, uppercase at k + 1 and space at k + 2, 32 line ends per step
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i letter_a = _mm256_set1_epi8('A');
+    const __m256i letter_span = _mm256_set1_epi8('Z' - 'A');
+
+    for (; i + 34 <= n; i += 32) {
+        const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 1));
+        const __m256i b2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 2));
+
+        const __m256i is_newline = _mm256_cmpeq_epi8(b0, newline);
+        const __m256i offset = _mm256_sub_epi8(b1, letter_a);
+        const __m256i is_upper = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, letter_span), offset);
+        const __m256i is_space = _mm256_cmpeq_epi8(b2, space);
+
+        const auto newlines = static_cast<std::uint32_t>(_mm256_movemask_epi8(is_newline));
+        auto candidates = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(is_newline, _mm256_and_si256(is_upper, is_space))));
+
+        while (candidates != 0) {
+            const int bit = std::countr_zero(candidates);
+            const std::uint32_t through_bit = (2u << bit) - 1u;
+            on_candidate(i + std::size_t(bit) + 1, line + std::size_t(std::popcount(newlines & through_bit)));
+            candidates &= candidates - 1;
+        }
+
+        line += std::size_t(std::popcount(newlines));
+    }
+#endif
+
+    while (i < n) {
+        const char* nl = static_cast<const char*>(std::memchr(data + i, '\n', n - i));
+        if (nl == nullptr) break;
+        i = std::size_t(nl - data) + 1;
+        check(i, ++line);
     }
+}
+
+// @SECTION: Byte range of one section within the text, banner line excluded
+struct __AvidPTSectionRange
+{
+    std::size_t begin = 0;
+    std::size_t end   = 0;
+    std::size_t line  = 1; // Line number of the byte at begin
+    bool found        = false;
+};
+
+// @SECTION: Where each section of an export lives, built by one scan for the
+// banner lines. The header runs from the start of the text to the first
+// banner. Repeated banners are ignored after the first
+struct __AvidPTEDLSectionIndex
+{
+    static constexpr std::size_t count = static_cast<std::size_t>(__AvidPTEDLSection::none);
+
+    std::array<__AvidPTSectionRange, count> ranges{};
 
-    track_t& operator[](std::size_t index) const
+    static auto build(const std::string_view text) -> __AvidPTEDLSectionIndex
     {
-        VTM_TODO("not implemented");
+        __AvidPTEDLSectionIndex index;
+        __AvidPTSectionRange* open = &index.ranges[std::size_t(__AvidPTEDLSection::header)];
+        *open = __AvidPTSectionRange{ 0, text.size(), 1, true };
+
+        avidpt_scan_banner_candidates(text, [&](const std::size_t start, const std::size_t line) {
+            const char* nl = static_cast<const char*>(std::memchr(text.data() + start, '\n', text.size() - start));
+            const std::size_t end = nl ? std::size_t(nl - text.data()) : text.size();
+            const std::size_t length = (end > start && text[end - 1] == '\r') ? end - start - 1 : end - start;
+
+            const auto section = avidpt_section_of(text.substr(start, length));
+            if (section == __AvidPTEDLSection::none) return;
+
+            if (open != nullptr) open->end = start;
+
+            __AvidPTSectionRange& range = index.ranges[std::size_t(section)];
+            if (range.found) {
+                open = nullptr;
+                return;
+            }
+
+            const std::size_t begin = nl ? end + 1 : end;
+            range = __AvidPTSectionRange{ begin, text.size(), line + 1, true };
+            open = &range;
+        });
+
+        return index;
     }
 
-    event_t get_event(const std::string_view& name)
+    auto contains(const __AvidPTEDLSection section) const noexcept -> bool
     {
-        VTM_TODO("not implemented");
+        return section != __AvidPTEDLSection::none && this->ranges[std::size_t(section)].found;
     }
 
-    event_t& get_event(const std::string_view& name) const
+    auto range(const __AvidPTEDLSection section) const -> const __AvidPTSectionRange&
     {
-        VTM_TODO("not implemented");
+        VTM_ASSERT(section != __AvidPTEDLSection::none, "no section index entry for none");
+        return this->ranges[std::size_t(section)];
     }
 
-private:
-    data_t _data;
+    // Text of a section, empty if the export has no such section
+    auto text(const std::string_view source, const __AvidPTEDLSection section) const noexcept -> std::string_view
+    {
+        if (!this->contains(section)) return {};
+        const auto& range = this->ranges[std::size_t(section)];
+        return source.substr(range.begin, range.end - range.begin);
+    }
 };
 
-} // @END OF namespace vtm::edl::internal
+// @SECTION: One "TRACK NAME:" block of the track listing, up to the next one
+struct __AvidPTTrackBlock
+{
+    std::string_view text;
+    std::size_t line = 1; // Line number of the "TRACK NAME:" line
+};
 
-//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Track blocks of a track listing section starting at first_line. Text before
+// the first "TRACK NAME:" line is dropped
+inline auto avidpt_split_track_blocks(const std::string_view section, const std::size_t first_line) -> std::vector<__AvidPTTrackBlock>
+{
+    constexpr std::string_view key = "TRACK NAME:";
+    std::vector<__AvidPTTrackBlock> blocks;
 
-namespace vtm {
+    std::size_t line = first_line;
+    std::size_t counted = 0;
+    std::size_t at = section.starts_with(key) ? 0 : section.find("\nTRACK NAME:");
+    if (at != 0 && at != std::string_view::npos) ++at;
 
-    // Avid Pro Tools EDL file parser
-    using avidpt_edl = edl::internal::__AvidPTEDLFile< std::string,
-                                                       std::string_view >;
-} // @END OF namespace vtm
+    while (at != std::string_view::npos) {
+        line += std::size_t(std::count(section.begin() + counted, section.begin() + at, '\n'));
+        counted = at;
+
+        std::size_t next = section.find("\nTRACK NAME:", at + key.size());
+        if (next != std::string_view::npos) ++next;
+
+        const std::size_t end = next == std::string_view::npos ? section.size() : next;
+        blocks.push_back(__AvidPTTrackBlock{ section.substr(at, end - at), line });
+        at = next;
+    }
+
+    return blocks;
+}
+
+// @SECTION: Line parsers shared by the section and streaming parsers. Strings
+// go through make_string, which decides whether they are copied or viewed
+
+// Header keys other than SESSION START TIMECODE, which the callers keep raw
+// until the TIMECODE FORMAT line has been read. Unknown keys are ignored
+template<typename THeader, typename FString>
+inline auto avidpt_header_line(const std::string_view line, const std::size_t lineno, THeader& header, FString&& make_string) -> void
+{
+    std::string_view value;
+    if (avidpt_key_value(line, "SESSION NAME:", value)) {
+        header.session_name = make_string(value);
+    } else if (avidpt_key_value(line, "SAMPLE RATE:", value)) {
+        header.sample_rate = avidpt_to_unsigned<std::uint32_t>(value, lineno);
+    } else if (avidpt_key_value(line, "BIT DEPTH:", value)) {
+        header.bit_depth = avidpt_to_unsigned<std::uint32_t>(value, lineno);
+    } else if (avidpt_key_value(line, "TIMECODE FORMAT:", value)) {
+        header.timecode_format = __AVIDPTEDL_STRING_TO_FPS(value);
+    } else if (avidpt_key_value(line, "# OF AUDIO TRACKS:", value)) {
+        header.audio_tracks = avidpt_to_unsigned<std::uint32_t>(value, lineno);
+    } else if (avidpt_key_value(line, "# OF AUDIO CLIPS:", value)) {
+        header.audio_clips = avidpt_to_unsigned<std::uint32_t>(value, lineno);
+    } else if (avidpt_key_value(line, "# OF AUDIO FILES:", value)) {
+        header.audio_files = avidpt_to_unsigned<std::uint32_t>(value, lineno);
+    }
+}
+
+// Value of a track STATE line as __AvidPTTrackState flags
+inline auto avidpt_track_state(std::string_view value) noexcept -> std::uint64_t
+{
+    std::uint64_t state = 0;
+    while (!value.empty()) {
+        const std::size_t space = value.find(' ');
+        const std::string_view word = value.substr(0, space);
+        value.remove_prefix(space == std::string_view::npos ? value.size() : space + 1);
+
+        __AvidPTTrackState flag = __AvidPTTrackState::none;
+        if (word == "Inactive")    flag = __AvidPTTrackState::inactive;
+        else if (word == "Hidden") flag = __AvidPTTrackState::hidden;
+        else if (word == "Muted")  flag = __AvidPTTrackState::muted;
+        else if (word == "Solo")   flag = __AvidPTTrackState::solo;
+        state |= static_cast<std::uint64_t>(flag);
+    }
+
+    return state;
+}
+
+// Value of a USER DELAY line, "12 Samples" or "3 Frames"
+template<typename TTrack>
+inline auto avidpt_user_delay(const std::string_view value, const std::size_t lineno, TTrack& track) -> void
+{
+    const std::size_t space = value.find(' ');
+    track.delay.delay = avidpt_to_unsigned<std::uint32_t>(value.substr(0, space), lineno);
+
+    const std::string_view unit = space == std::string_view::npos ? std::string_view{} : avidpt_trim(value.substr(space));
+    track.delay.unit = unit.starts_with("Frame") ? TimelineUnitFormat::frames : TimelineUnitFormat::samples;
+}
+
+// Splits a row into at most max_fields fields, returns the count
+inline auto avidpt_split_row(std::string_view line, std::array<std::string_view, __AvidPTEventColumns::max_fields>& fields) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    while (!line.empty() && count < fields.size()) fields[count++] = avidpt_next_field(line);
+    return count;
+}
+
+template<typename TEvent, typename F, typename FString>
+inline auto avidpt_event_row(const std::string_view line, const std::size_t lineno, const __AvidPTEventColumns& columns,
+                             const __AvidPTTimeFormat<F>& format, FString&& make_string) -> TEvent
+{
+    std::array<std::string_view, __AvidPTEventColumns::max_fields> fields{};
+    const std::size_t count = avidpt_split_row(line, fields);
+
+    const auto field = [&](const std::size_t column) -> std::string_view {
+        return column < count ? fields[column] : std::string_view{};
+    };
+
+    const auto time = [&](const std::size_t column) -> typename TEvent::timecode_t {
+        if (column >= count)
+            throw std::runtime_error(fmt::format("line {}: event row is missing a time column", lineno));
+        return format.to_ticks(fields[column], lineno);
+    };
+
+    TEvent event;
+    event.channel    = avidpt_to_unsigned<std::uint32_t>(field(columns.channel), lineno);
+    event.id         = avidpt_to_unsigned<std::uint32_t>(field(columns.event), lineno);
+    event.name       = make_string(field(columns.name));
+    event.start_time = time(columns.start);
+    event.end_time   = time(columns.end);
+    event.duration   = time(columns.duration);
+    event.state      = make_string(field(columns.state));
+    return event;
+}
+
+template<typename TMarker, typename F, typename FString>
+inline auto avidpt_marker_row(const std::string_view line, const std::size_t lineno, const __AvidPTMarkerColumns& columns,
+                              const __AvidPTTimeFormat<F>& format, FString&& make_string) -> TMarker
+{
+    std::array<std::string_view, __AvidPTEventColumns::max_fields> fields{};
+    const std::size_t count = avidpt_split_row(line, fields);
+
+    const auto field = [&](const std::size_t column) -> std::string_view {
+        return column < count ? fields[column] : std::string_view{};
+    };
+
+    if (columns.location >= count)
+        throw std::runtime_error(fmt::format("line {}: marker row is missing its location", lineno));
+
+    TMarker marker;
+    marker.id             = avidpt_to_unsigned<std::uint32_t>(field(columns.id), lineno);
+    marker.location       = format.to_ticks(fields[columns.location], lineno);
+    marker.time_reference = avidpt_to_unsigned<std::uint64_t>(field(columns.time_reference), lineno);
+    marker.units          = make_string(field(columns.units));
+    marker.name           = make_string(field(columns.name));
+    marker.comments       = make_string(field(columns.comments));
+    return marker;
+}
+
+// @SECTION: Position of an event, its track in the track listing and its row
+// within that track
+struct __AvidPTEventRef
+{
+    std::size_t track = 0;
+    std::size_t event = 0;
+
+    bool operator==(const __AvidPTEventRef&) const = default;
+};
+
+// @SECTION: Name to positions index, one open addressing table over the
+// distinct names with linear probing. Positions of one name are stored next to
+// each other in insertion order, so a lookup is one probe sequence and a span.
+// Names are views and must outlive the index
+template<typename TRef>
+class __AvidPTNameIndex
+{
+public:
+    using ref_t = TRef;
+
+    // Room for n insertions. The table itself grows with the distinct names,
+    // which are usually far fewer than the insertions
+    auto reserve(const std::size_t n) -> void
+    {
+        this->_staging.reserve(n);
+    }
+
+    auto insert(const std::string_view name, const ref_t ref) -> void
+    {
+        if ((this->_keys.size() + 1) * 2 > this->_slots.size())
+            this->rehash(std::max<std::size_t>(this->_slots.size() * 2, 16));
+
+        const std::size_t hash = std::hash<std::string_view>{}(name);
+        std::size_t at = this->probe(name, hash);
+        if (this->_slots[at].key == 0) {
+            this->_keys.push_back(key_t{ name, hash, 0, 0 });
+            this->_slots[at] = slot_t{ std::uint32_t(this->_keys.size()), tag(hash) };
+        }
+
+        const std::uint32_t key = this->_slots[at].key - 1;
+        ++this->_keys[key].count;
+        this->_staging.emplace_back(key, ref);
+    }
+
+    // Groups the inserted positions by name, call once every name is inserted
+    auto finish() -> void
+    {
+        std::uint32_t first = 0;
+        for (auto& key : this->_keys) {
+            key.first = first;
+            first += key.count;
+        }
+
+        this->_refs.resize(this->_staging.size());
+        std::vector<std::uint32_t> next(this->_keys.size());
+        for (std::size_t i = 0; i < this->_keys.size(); ++i) next[i] = this->_keys[i].first;
+        for (const auto& [key, ref] : this->_staging) this->_refs[next[key]++] = ref;
+
+        this->_staging.clear();
+        this->_staging.shrink_to_fit();
+    }
+
+    // Positions inserted under name, empty when there are none
+    auto find(const std::string_view name) const noexcept -> std::span<const ref_t>
+    {
+        if (this->_slots.empty()) return {};
+
+        const slot_t& slot = this->_slots[this->probe(name, std::hash<std::string_view>{}(name))];
+        if (slot.key == 0) return {};
+
+        const key_t& key = this->_keys[slot.key - 1];
+        return std::span<const ref_t>(this->_refs).subspan(key.first, key.count);
+    }
+
+    // Count of distinct names
+    auto size() const noexcept -> std::size_t { return this->_keys.size(); }
+
+    auto clear() noexcept -> void
+    {
+        this->_slots.clear();
+        this->_keys.clear();
+        this->_refs.clear();
+        this->_staging.clear();
+    }
+
+private:
+    // Key 0 marks an empty slot, otherwise the key index plus one. The tag is
+    // the upper half of the hash, most mismatches fail on it without a compare
+    struct slot_t
+    {
+        std::uint32_t key = 0;
+        std::uint32_t tag = 0;
+    };
+
+    struct key_t
+    {
+        std::string_view name;
+        std::size_t hash = 0;
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;
+    };
+
+    static auto tag(const std::size_t hash) noexcept -> std::uint32_t
+    {
+        return std::uint32_t(std::uint64_t(hash) >> 32);
+    }
+
+    // Slot holding name, or the empty slot it would go into
+    auto probe(const std::string_view name, const std::size_t hash) const noexcept -> std::size_t
+    {
+        const std::size_t mask = this->_slots.size() - 1;
+        for (std::size_t at = hash & mask;; at = (at + 1) & mask) {
+            const slot_t& slot = this->_slots[at];
+            if (slot.key == 0) return at;
+            if (slot.tag == tag(hash) && this->_keys[slot.key - 1].name == name) return at;
+        }
+    }
+
+    auto rehash(const std::size_t capacity) -> void
+    {
+        this->_slots.assign(capacity, slot_t{});
+        for (std::size_t i = 0; i < this->_keys.size(); ++i) {
+            std::size_t at = this->_keys[i].hash & (capacity - 1);
+            while (this->_slots[at].key != 0) at = (at + 1) & (capacity - 1);
+            this->_slots[at] = slot_t{ std::uint32_t(i + 1), tag(this->_keys[i].hash) };
+        }
+    }
+
+private:
+    std::vector<slot_t> _slots;
+    std::vector<key_t> _keys;
+    std::vector<ref_t> _refs;
+    std::vector<std::pair<std::uint32_t, ref_t>> _staging;
+};
+
+// @SECTION: Time range index over [start, end) intervals. Every interval is
+// kept sorted by start, so those starting inside a range are one binary search
+// and a run. Those already playing at the start of the range are found in a
+// centered interval tree over the same rows: each node holds the intervals
+// containing its center, ordered by start and by end, and a stab descends one
+// path and stops each scan at the first miss. A query is O(log n + matches)
+template<typename T, typename TRef>
+class __AvidPTIntervalIndex
+{
+public:
+    using timecode_t = T;
+    using ref_t  = TRef;
+
+    auto reserve(const std::size_t n) -> void
+    {
+        this->_rows.reserve(n);
+    }
+
+    auto insert(const timecode_t start, const timecode_t end, const ref_t ref) -> void
+    {
+        this->_rows.push_back(row_t{ start, end, ref });
+    }
+
+    // Sorts the rows and builds the tree, call once every interval is inserted
+    auto finish() -> void
+    {
+        VTM_ASSERT(this->_rows.size() < none, "interval index exceeds 4G intervals");
+        std::ranges::stable_sort(this->_rows, {}, &row_t::start);
+
+        // Empty intervals never contain a point, only the sorted run finds them
+        std::vector<std::uint32_t> items;
+        items.reserve(this->_rows.size());
+        for (std::size_t i = 0; i < this->_rows.size(); ++i) {
+            if (this->_rows[i].start < this->_rows[i].end) items.push_back(std::uint32_t(i));
+        }
+
+        this->_by_start.reserve(items.size());
+        this->_by_end.reserve(items.size());
+        this->_root = this->build(items);
+    }
+
+    // Appends every interval overlapping [lo, hi): those playing at lo in no
+    // particular order, then those starting in the range in start order. With
+    // lo == hi it is the intervals playing at lo, start <= lo < end, and with
+    // hi < lo nothing
+    auto find(const timecode_t lo, const timecode_t hi, std::vector<ref_t>& out) const -> void
+    {
+        if (hi < lo) return;
+
+        for (std::uint32_t at = this->_root; at != none;) {
+            const node_t& node = this->_nodes[at];
+            const auto starts = std::span<const std::uint32_t>(this->_by_start).subspan(node.first, node.count);
+            const auto ends = std::span<const std::uint32_t>(this->_by_end).subspan(node.first, node.count);
+
+            if (lo > node.center) {
+                for (const std::uint32_t i : ends) {
+                    if (!(this->_rows[i].end > lo)) break;
+                    out.push_back(this->_rows[i].ref);
+                }
+                at = node.right;
+            } else {
+                for (const std::uint32_t i : starts) {
+                    if (!(this->_rows[i].start < lo)) break;
+                    out.push_back(this->_rows[i].ref);
+                }
+                at = lo < node.center ? node.left : none;
+            }
+        }
+
+        // A point query also takes the intervals starting at lo
+        auto row = std::ranges::lower_bound(this->_rows, lo, {}, &row_t::start);
+        for (; row != this->_rows.end() && (row->start < hi || row->start == lo); ++row) {
+            if (row->end > lo) out.push_back(row->ref);
+        }
+    }
+
+    auto size() const noexcept -> std::size_t { return this->_rows.size(); }
+
+    auto clear() noexcept -> void
+    {
+        this->_rows.clear();
+        this->_nodes.clear();
+        this->_by_start.clear();
+        this->_by_end.clear();
+        this->_root = none;
+    }
+
+private:
+    static constexpr std::uint32_t none = UINT32_MAX;
+
+    struct row_t
+    {
+        timecode_t start{};
+        timecode_t end{};
+        ref_t ref{};
+    };
+
+    // Intervals holding center are _by_start/_by_end[first, first + count)
+    struct node_t
+    {
+        timecode_t center{};
+        std::uint32_t first = 0;
+        std::uint32_t count = 0;
+        std::uint32_t left = none;
+        std::uint32_t right = none;
+    };
+
+    // Items are row indices in start order. The center is the median start,
+    // the intervals starting there hold it, so each side gets at most half
+    auto build(const std::span<std::uint32_t> items) -> std::uint32_t
+    {
+        if (items.empty()) return none;
+
+        const timecode_t center = this->_rows[items[items.size() / 2]].start;
+        const auto starts_after = std::ranges::upper_bound(items, center, {}, [this](const std::uint32_t i) { return this->_rows[i].start; });
+        const auto before = items.first(std::size_t(starts_after - items.begin()));
+        const auto ended = std::ranges::stable_partition(before, [&](const std::uint32_t i) { return !(this->_rows[i].end > center); });
+        const auto holding = std::span<std::uint32_t>(ended.begin(), ended.end());
+
+        const std::uint32_t at = std::uint32_t(this->_nodes.size());
+        this->_nodes.push_back(node_t{ center, std::uint32_t(this->_by_start.size()), std::uint32_t(holding.size()) });
+        this->_by_start.insert(this->_by_start.end(), holding.begin(), holding.end());
+        this->_by_end.insert(this->_by_end.end(), holding.begin(), holding.end());
+        std::ranges::sort(std::span<std::uint32_t>(this->_by_end).last(holding.size()), std::ranges::greater{}, [this](const std::uint32_t i) { return this->_rows[i].end; });
+
+        const std::uint32_t left = this->build(before.first(before.size() - holding.size()));
+        const std::uint32_t right = this->build(items.subspan(before.size()));
+        this->_nodes[at].left = left;
+        this->_nodes[at].right = right;
+        return at;
+    }
+
+private:
+    std::vector<row_t> _rows;
+    std::vector<node_t> _nodes;
+    std::vector<std::uint32_t> _by_start;
+    std::vector<std::uint32_t> _by_end;
+    std::uint32_t _root = none;
+};
+
+// @SECTION: Parser of a Pro Tools "Export Session Info as Text" file into
+// TData, one section at a time. Strings are constructed from views of the
+// text, so with a view string type the parsed data aliases the text and
+// nothing is copied. The track listing needs the header parsed first for its
+// time format. Track blocks are independent, given a thread pool they are
+// parsed concurrently into their final slots, so the track order is the file
+// order. Malformed input throws std::runtime_error naming the line
+template<typename TData>
+class __AvidPTEDLParser
+{
+public:
+    using data_t        = TData;
+    using string_t      = typename data_t::string_t;
+    using track_t       = typename data_t::track_t;
+    using event_t       = typename data_t::event_t;
+    using timecode_t    = typename data_t::timecode_t;
+    using time_format_t = __AvidPTTimeFormat<timecode_t>;
+    using index_t       = __AvidPTEDLSectionIndex;
+    using pool_t        = vtm::utility::internal::__ThreadPool;
+
+    explicit __AvidPTEDLParser(data_t& data, pool_t* pool = nullptr) noexcept
+        : _data(data)
+        , _pool(pool)
+    {}
+
+    // Every section with a data model, in one go
+    auto parse(const std::string_view text) -> void
+    {
+        const auto index = index_t::build(text);
+        this->_data.clear();
+        this->parse_section(text, index, __AvidPTEDLSection::header);
+        this->parse_section(text, index, __AvidPTEDLSection::track_listing);
+    }
+
+    // Sections without a data model are skipped
+    auto parse_section(const std::string_view text, const index_t& index, const __AvidPTEDLSection section) -> void
+    {
+        if (!index.contains(section)) return;
+        this->_rest = index.text(text, section);
+        this->_line = index.range(section).line - 1;
+
+        switch (section) {
+            case __AvidPTEDLSection::header:        this->parse_header(); break;
+            case __AvidPTEDLSection::track_listing: this->parse_tracks(); break;
+            default: break;
+        }
+    }
+
+    // Parses one block into track, needs the header parsed
+    auto parse_track_block(const __AvidPTTrackBlock& block, track_t& track) -> void
+    {
+        this->_rest = block.text;
+        this->_line = block.line - 1;
+        this->_columns.reset();
+
+        std::string_view value;
+        avidpt_key_value(this->next_line(), "TRACK NAME:", value);
+        track.name = this->make_string(value);
+
+        while (!this->_rest.empty()) this->parse_track_line(this->next_line(), track);
+    }
+
+private:
+    // Data with a string arena gets interned copies, any other data strings
+    // constructed from the view. Events may use a string type of their own
+    template<typename T = string_t>
+    auto make_string(const std::string_view value) -> T
+    {
+        if constexpr (requires { this->_data.strings.intern(value); }) {
+            return T(this->_data.strings.intern(value));
+        } else {
+            return T(value);
+        }
+    }
+
+    auto next_line() noexcept -> std::string_view
+    {
+        ++this->_line;
+        return avidpt_next_line(this->_rest);
+    }
+
+    auto parse_header() -> void
+    {
+        while (!this->_rest.empty()) this->parse_header_line(this->next_line());
+
+        // The start timecode precedes the format line, so it is converted last
+        const time_format_t format = time_format_t::from_session(this->_data.timecode_format, this->_data.sample_rate);
+        if (!this->_session_start.empty())
+            this->_data.session_start = format.to_ticks(this->_session_start, this->_session_start_line);
+    }
+
+    auto parse_tracks() -> void
+    {
+        this->_format = time_format_t::from_session(this->_data.timecode_format, this->_data.sample_rate);
+
+        const auto blocks = avidpt_split_track_blocks(this->_rest, this->_line + 1);
+        auto& tracks = this->_data.tracks;
+        tracks.clear();
+        tracks.reserve(blocks.size());
+        for (std::size_t i = 0; i < blocks.size(); ++i) tracks.emplace_back(i, track_t{});
+
+        if (this->_pool == nullptr || this->_pool->size() == 0 || blocks.size() < 2) {
+            for (std::size_t i = 0; i < blocks.size(); ++i) this->parse_track_block(blocks[i], tracks[i].second);
+            return;
+        }
+
+        // Slots are sized up front, workers only write the track they parse
+        this->_pool->parallel_for(blocks.size(), [&](const std::size_t i) {
+            __AvidPTEDLParser worker(*this);
+            worker.parse_track_block(blocks[i], tracks[i].second);
+        });
+    }
+
+    auto parse_header_line(std::string_view line) -> void
+    {
+        std::string_view value;
+        if (avidpt_key_value(line, "SESSION START TIMECODE:", value)) {
+            this->_session_start = value;
+            this->_session_start_line = this->_line;
+        } else {
+            avidpt_header_line(line, this->_line, this->_data, [this](const std::string_view v) { return this->make_string(v); });
+        }
+    }
+
+    auto parse_track_line(std::string_view line, track_t& track) -> void
+    {
+        std::string_view value;
+        if (avidpt_trim(line).empty()) return;
+
+        if (this->_columns) {
+            this->parse_event_row(line, track);
+        } else if (avidpt_key_value(line, "COMMENTS:", value)) {
+            track.comments = this->make_string(value);
+        } else if (avidpt_key_value(line, "USER DELAY:", value)) {
+            avidpt_user_delay(value, this->_line, track);
+        } else if (avidpt_key_value(line, "STATE:", value)) {
+            track.state = avidpt_track_state(value);
+        } else if (line.starts_with("CHANNEL")) {
+            this->_columns = __AvidPTEventColumns::from_header(line);
+            track.events.reserve(this->count_event_rows());
+        }
+    }
+
+    // Rows up to the blank line ending the track block, one newline scan ahead
+    // of the parser saves regrowing the event vector
+    auto count_event_rows() const noexcept -> std::size_t
+    {
+        std::size_t rows = 0;
+        std::string_view rest = this->_rest;
+        while (!rest.empty()) {
+            const char* nl = static_cast<const char*>(std::memchr(rest.data(), '\n', rest.size()));
+            const std::size_t length = nl ? std::size_t(nl - rest.data()) : rest.size();
+            if (length == 0 || (length == 1 && rest[0] == '\r')) break;
+            ++rows;
+            rest.remove_prefix(nl ? length + 1 : length);
+        }
+
+        return rows;
+    }
+
+    auto parse_event_row(const std::string_view line, track_t& track) -> void
+    {
+        const auto make_string = [this](const std::string_view v) { return this->template make_string<typename event_t::string_t>(v); };
+        track.events.emplace_back(track.events.size(), avidpt_event_row<event_t>(line, this->_line, *this->_columns, this->_format, make_string));
+    }
+
+private:
+    data_t& _data;
+    pool_t* _pool = nullptr;
+    std::string_view _rest;
+    std::size_t _line = 0;
+    std::string_view _session_start;
+    std::size_t _session_start_line = 0;
+    time_format_t _format{};
+    std::optional<__AvidPTEventColumns> _columns;
+};
+
+// Line ending of an export, taken from its first line
+inline auto avidpt_newline_of(const std::string_view text) noexcept -> std::string_view
+{
+    const std::size_t nl = text.find('\n');
+    return (nl != std::string_view::npos && nl > 0 && text[nl - 1] == '\r') ? "\r\n" : "\n";
+}
+
+// @SECTION: Writer of TData as a Pro Tools text export, the inverse of
+// __AvidPTEDLParser for the sections it parses. Text is appended to one
+// fmt::memory_buffer, fields padded to the widths Pro Tools uses, so an export
+// parsed and written again comes out byte for byte. Events are written in the
+// seven column layout of event_header. Columns the event model does not hold,
+// such as TIMESTAMP, are not kept by the parser, so tracks exported with them
+// come back without those columns. Nothing is allocated per
+// row, times are formatted straight into the buffer. Times are formatted in
+// double, the half frame margins of the labels leave plenty of precision
+template<typename TData>
+class __AvidPTEDLWriter
+{
+public:
+    using data_t        = TData;
+    using track_t       = typename data_t::track_t;
+    using event_t       = typename data_t::event_t;
+    using timecode_t    = typename data_t::timecode_t;
+    using time_format_t = __AvidPTTimeFormat<double>;
+    using buffer_t      = fmt::memory_buffer;
+
+    static constexpr std::string_view event_header = "CHANNEL \tEVENT   \tCLIP NAME                     \t"
+                                                     "START TIME    \tEND TIME      \tDURATION      \tSTATE";
+
+    explicit __AvidPTEDLWriter(const data_t& data, const std::string_view newline = "\n")
+        : _data(data)
+        , _newline(newline)
+        , _format(time_format_t::from_session(data.timecode_format, data.sample_rate))
+    {}
+
+    // Header lines and the two blank lines ending them
+    auto write_header(buffer_t& out) const -> void
+    {
+        this->append(out, "SESSION NAME:\t");
+        this->line(out, this->_data.session_name);
+        this->append(out, "SAMPLE RATE:\t");
+        this->number(out, this->_data.sample_rate);
+        this->line(out, ".000000");
+        this->append(out, "BIT DEPTH:\t");
+        this->number(out, this->_data.bit_depth);
+        this->line(out, "-bit");
+        if (this->_format.fps != vtm::fps::none) {
+            this->append(out, "SESSION START TIMECODE:\t");
+            this->time(out, this->_data.session_start);
+            this->line(out, "");
+        }
+        this->append(out, "TIMECODE FORMAT:\t");
+        this->line(out, __AVIDPTEDL_FPS_TO_STRING(this->_data.timecode_format));
+        this->append(out, "# OF AUDIO TRACKS:\t");
+        this->number(out, this->_data.audio_tracks);
+        this->line(out, "");
+        this->append(out, "# OF AUDIO CLIPS:\t");
+        this->number(out, this->_data.audio_clips);
+        this->line(out, "");
+        this->append(out, "# OF AUDIO FILES:\t");
+        this->number(out, this->_data.audio_files);
+        this->line(out, "");
+        this->line(out, "");
+        this->line(out, "");
+    }
+
+    // Banner and every track. flush(out) is called between tracks once out
+    // holds flush_size bytes, and must leave out empty
+    template<typename FFlush>
+    auto write_tracks(buffer_t& out, FFlush&& flush, const std::size_t flush_size) const -> void
+    {
+        this->line(out, __AVIDPTEDL_VALUE_TO_STRING(__AvidPTEDLSection::track_listing));
+        for (const auto& [i, track] : this->_data.tracks) {
+            this->write_track(out, track);
+            if (out.size() >= flush_size) flush(out);
+        }
+    }
+
+    auto write_tracks(buffer_t& out) const -> void
+    {
+        this->write_tracks(out, [](buffer_t&) {}, SIZE_MAX);
+    }
+
+    // One track block and the two blank lines ending it
+    auto write_track(buffer_t& out, const track_t& track) const -> void
+    {
+        this->append(out, "TRACK NAME:\t");
+        this->line(out, track.name);
+        this->append(out, "COMMENTS:\t");
+        this->line(out, track.comments);
+        this->append(out, "USER DELAY:\t");
+        this->number(out, track.delay.delay);
+        this->line(out, track.delay.unit == TimelineUnitFormat::frames ? " Frames" : " Samples");
+        this->append(out, "STATE: \t");
+        this->state(out, track.state);
+        this->line(out, "");
+        this->line(out, "PLUG-INS: \t");
+        this->line(out, event_header);
+
+        for (const auto& [i, event] : track.events) {
+            this->padded_number(out, event.channel, 8);
+            this->padded_number(out, event.id, 8);
+            this->padded(out, event.name, 30);
+            this->padded_time(out, event.start_time);
+            this->padded_time(out, event.end_time);
+            this->padded_time(out, event.duration);
+            this->line(out, event.state);
+        }
+
+        this->line(out, "");
+        this->line(out, "");
+    }
+
+private:
+    static auto append(buffer_t& out, const std::string_view s) -> void
+    {
+        out.append(s.data(), s.data() + s.size());
+    }
+
+    auto line(buffer_t& out, const std::string_view s) const -> void
+    {
+        append(out, s);
+        append(out, this->_newline);
+    }
+
+    // s, spaces up to width and the tab ending the field
+    static auto padded(buffer_t& out, const std::string_view s, const std::size_t width) -> void
+    {
+        constexpr std::string_view spaces = "                                ";
+        append(out, s);
+        if (s.size() < width) append(out, spaces.substr(0, width - s.size()));
+        out.push_back('\t');
+    }
+
+    static auto number(buffer_t& out, const std::uint64_t value) -> void
+    {
+        char digits[20];
+        append(out, std::string_view(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr));
+    }
+
+    static auto padded_number(buffer_t& out, const std::uint64_t value, const std::size_t width) -> void
+    {
+        char digits[20];
+        padded(out, std::string_view(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr), width);
+    }
+
+    auto time(buffer_t& out, const timecode_t ticks) const -> void
+    {
+        char text[time_format_t::max_chars];
+        append(out, std::string_view(text, this->_format.format_to(text, double(ticks))));
+    }
+
+    auto padded_time(buffer_t& out, const timecode_t ticks) const -> void
+    {
+        char text[time_format_t::max_chars];
+        padded(out, std::string_view(text, this->_format.format_to(text, double(ticks))), 14);
+    }
+
+    static auto state(buffer_t& out, const std::uint64_t flags) -> void
+    {
+        constexpr std::array words{
+            std::pair{ __AvidPTTrackState::inactive, std::string_view("Inactive") },
+            std::pair{ __AvidPTTrackState::hidden, std::string_view("Hidden") },
+            std::pair{ __AvidPTTrackState::muted, std::string_view("Muted") },
+            std::pair{ __AvidPTTrackState::solo, std::string_view("Solo") },
+        };
+
+        bool first = true;
+        for (const auto& [flag, word] : words) {
+            if (!(flags & static_cast<std::uint64_t>(flag))) continue;
+            if (!first) out.push_back(' ');
+            append(out, word);
+            first = false;
+        }
+    }
+
+private:
+    const data_t& _data;
+    std::string_view _newline;
+    time_format_t _format;
+};
+
+// @SECTION: Push parser of a Pro Tools export arriving in chunks of any size.
+// Complete lines are parsed in place, a line split between chunks is carried
+// over in a buffer as long as the longest line, so memory does not grow with
+// the file. Results go to the visitor as they are parsed, string views in them
+// are valid during the callback only. Every callback is optional:
+//   on_session_header(const header_t&)        once, when the header ends
+//   on_track_begin(const track_t&)            before the first event of a track
+//   on_event(const track_t&, const event_t&)  each event row
+//   on_track_end(const track_t&)              after the last event of a track
+//   on_marker(const marker_t&)                each marker row
+// Tracks are passed without events. Malformed input throws std::runtime_error
+// naming the line
+template<typename TVisitor>
+class __AvidPTEDLStreamParser
+{
+public:
+    using visitor_t     = TVisitor;
+    using header_t      = __AvidPTSessionHeader<std::string>;
+    using track_t       = __AvidPTTrack<std::string>;
+    using event_t       = __AvidPTTrackEvent<std::string_view>;
+    using marker_t      = __AvidPTMarker<std::string_view>;
+    using timecode_t    = vtm::chrono::float64_t;
+    using time_format_t = __AvidPTTimeFormat<timecode_t>;
+
+    explicit __AvidPTEDLStreamParser(visitor_t& visitor) noexcept
+        : _visitor(visitor)
+    {}
+
+    auto feed(std::string_view chunk) -> void
+    {
+        if (!this->_partial.empty()) {
+            const char* nl = static_cast<const char*>(std::memchr(chunk.data(), '\n', chunk.size()));
+            if (nl == nullptr) {
+                this->_partial.append(chunk);
+                return;
+            }
+
+            const std::size_t length = std::size_t(nl - chunk.data());
+            this->_partial.append(chunk.substr(0, length));
+            chunk.remove_prefix(length + 1);
+            this->parse_line(this->_partial);
+            this->_partial.clear();
+        }
+
+        for (;;) {
+            const char* nl = static_cast<const char*>(std::memchr(chunk.data(), '\n', chunk.size()));
+            if (nl == nullptr) break;
+
+            const std::size_t length = std::size_t(nl - chunk.data());
+            this->parse_line(chunk.substr(0, length));
+            chunk.remove_prefix(length + 1);
+        }
+
+        this->_partial.assign(chunk);
+    }
+
+    // Parses a last line without a terminator and closes the open section
+    auto finish() -> void
+    {
+        if (!this->_partial.empty()) {
+            this->parse_line(this->_partial);
+            this->_partial.clear();
+        }
+
+        this->enter_section(__AvidPTEDLSection::none);
+    }
+
+    auto lines() const noexcept -> std::size_t
+    {
+        return this->_line;
+    }
+
+    // Bytes held for a line split between chunks
+    auto carried() const noexcept -> std::size_t
+    {
+        return this->_partial.capacity();
+    }
+
+private:
+    auto parse_line(std::string_view line) -> void
+    {
+        ++this->_line;
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        if (const auto section = avidpt_section_of(line); section != __AvidPTEDLSection::none) {
+            this->enter_section(section);
+            return;
+        }
+
+        switch (this->_section) {
+            case __AvidPTEDLSection::header:          this->parse_header_line(line); break;
+            case __AvidPTEDLSection::track_listing:   this->parse_track_line(line); break;
+            case __AvidPTEDLSection::markers_listing: this->parse_marker_line(line); break;
+            default: break;
+        }
+    }
+
+    // Closes the current section, the header is complete once any section starts
+    auto enter_section(const __AvidPTEDLSection section) -> void
+    {
+        if (this->_section == __AvidPTEDLSection::header) {
+            this->_format = time_format_t::from_session(this->_header.timecode_format, this->_header.sample_rate);
+            if (!this->_session_start.empty())
+                this->_header.session_start = this->_format.to_ticks(this->_session_start, this->_session_start_line);
+            if constexpr (requires { this->_visitor.on_session_header(this->_header); }) this->_visitor.on_session_header(this->_header);
+        } else if (this->_section == __AvidPTEDLSection::track_listing) {
+            this->end_track();
+        }
+
+        this->_section = section;
+        this->_marker_columns.reset();
+    }
+
+    auto parse_header_line(const std::string_view line) -> void
+    {
+        std::string_view value;
+        if (avidpt_key_value(line, "SESSION START TIMECODE:", value)) {
+            this->_session_start.assign(value);
+            this->_session_start_line = this->_line;
+        } else {
+            avidpt_header_line(line, this->_line, this->_header, [](const std::string_view v) { return std::string(v); });
+        }
+    }
+
+    auto parse_track_line(const std::string_view line) -> void
+    {
+        std::string_view value;
+        if (avidpt_trim(line).empty()) return;
+
+        if (avidpt_key_value(line, "TRACK NAME:", value)) {
+            this->end_track();
+            this->_track.clear();
+            this->_track.name.assign(value);
+            this->_in_track = true;
+            this->_event_columns.reset();
+            return;
+        }
+
+        // Text before the first track is skipped
+        if (!this->_in_track) return;
+
+        if (this->_event_columns) {
+            this->begin_track();
+            const auto event = avidpt_event_row<event_t>(line, this->_line, *this->_event_columns, this->_format,
+                                                         [](const std::string_view v) { return v; });
+            if constexpr (requires { this->_visitor.on_event(this->_track, event); }) this->_visitor.on_event(this->_track, event);
+        } else if (avidpt_key_value(line, "COMMENTS:", value)) {
+            this->_track.comments.assign(value);
+        } else if (avidpt_key_value(line, "USER DELAY:", value)) {
+            avidpt_user_delay(value, this->_line, this->_track);
+        } else if (avidpt_key_value(line, "STATE:", value)) {
+            this->_track.state = avidpt_track_state(value);
+        } else if (line.starts_with("CHANNEL")) {
+            this->_event_columns = __AvidPTEventColumns::from_header(line);
+            this->begin_track();
+        }
+    }
+
+    auto parse_marker_line(const std::string_view line) -> void
+    {
+        if (avidpt_trim(line).empty()) return;
+
+        if (!this->_marker_columns) {
+            if (line.starts_with("#")) this->_marker_columns = __AvidPTMarkerColumns::from_header(line);
+            return;
+        }
+
+        const auto marker = avidpt_marker_row<marker_t>(line, this->_line, *this->_marker_columns, this->_format,
+                                                        [](const std::string_view v) { return v; });
+        if constexpr (requires { this->_visitor.on_marker(marker); }) this->_visitor.on_marker(marker);
+    }
+
+    auto begin_track() -> void
+    {
+        if (this->_track_begun) return;
+        this->_track_begun = true;
+        if constexpr (requires { this->_visitor.on_track_begin(this->_track); }) this->_visitor.on_track_begin(this->_track);
+    }
+
+    auto end_track() -> void
+    {
+        if (!this->_in_track) return;
+        this->begin_track();
+        if constexpr (requires { this->_visitor.on_track_end(this->_track); }) this->_visitor.on_track_end(this->_track);
+        this->_in_track = false;
+        this->_track_begun = false;
+    }
+
+private:
+    visitor_t& _visitor;
+    std::string _partial;
+    std::size_t _line = 0;
+    __AvidPTEDLSection _section = __AvidPTEDLSection::header;
+    header_t _header;
+    std::string _session_start;
+    std::size_t _session_start_line = 0;
+    time_format_t _format{};
+    track_t _track;
+    bool _in_track = false;
+    bool _track_begun = false;
+    std::optional<__AvidPTEventColumns> _event_columns;
+    std::optional<__AvidPTMarkerColumns> _marker_columns;
+};
+
+// @SECTION: Session data whose strings are views into a string arena owned by
+// the data. Strings are interned, so repeated clip names and event states are
+// stored once, and clear() frees them all at once instead of one by one
+template<vtm::traits::StringLike TView>
+struct __AvidPTEDLArenaData : public __AvidPTEDLData<TView, TView>
+{
+    void clear() noexcept
+    {
+        __AvidPTEDLData<TView, TView>::clear();
+        strings.clear();
+    }
+
+    vtm::utility::internal::__StringArena strings;
+};
+
+// @SECTION: Session data whose tracks keep their events in a columnar store.
+// Event rows are copied into each track's string heap as they are parsed
+template<vtm::traits::StringLike TString, vtm::traits::StringLike TView>
+using __AvidPTEDLColumnarData = __AvidPTEDLData<TString, TView, __AvidPTTrack<TString, std::remove_cvref_t<TString>, __AvidPTEventStore<TView>>>;
+
+template< vtm::traits::StringLike TString = std::string,
+          vtm::traits::StringLike TView = std::string_view,
+          EDLFileCompatible Interface = EDLFile<TString, TView>,
+          EDLDataInterface TData = internal::__AvidPTEDLData<typename Interface::string_t, typename Interface::string_view_t> >
+class __AvidPTEDLFile : public Interface
+{
+public:
+    using string_t      = typename Interface::string_t;
+    using string_view_t = typename Interface::string_view_t;
+    using display_t     = typename Interface::display_t;
+    using data_t        = std::remove_cvref_t<TData>;
+    using track_t       = typename data_t::track_t;
+    using event_t       = typename data_t::event_t;
+    using parser_t      = __AvidPTEDLParser<data_t>;
+    using source_t      = vtm::utility::internal::__MappedFile;
+    using index_t       = __AvidPTEDLSectionIndex;
+    using section_t     = __AvidPTEDLSection;
+    using event_ref_t   = __AvidPTEventRef;
+    using writer_t      = __AvidPTEDLWriter<data_t>;
+    using timecode_t    = typename event_t::timecode_t;
+    using range_time_t  = typename __AvidPTStoredTime<typename track_t::data_t>::type;
+    using event_result_t = std::conditional_t<std::is_reference_v<decltype(std::declval<const typename track_t::data_t&>()[0])>,
+                                              const event_t&,
+                                              event_t>;
+
+    static constexpr std::size_t default_flush_size = std::size_t(16) << 20;
+
+    __AvidPTEDLFile() = default;
+    ~__AvidPTEDLFile() = default;
+    __AvidPTEDLFile(const __AvidPTEDLFile& edl_file) = default;
+    __AvidPTEDLFile(__AvidPTEDLFile&& edl_file) noexcept = default;
+    __AvidPTEDLFile& operator=(const __AvidPTEDLFile& edl_file) = default;
+    __AvidPTEDLFile& operator=(__AvidPTEDLFile&& edl_file) noexcept = default;
+
+    // Path constructors
+    explicit __AvidPTEDLFile(const string_view_t& path) noexcept
+    {
+        try {
+            this->parse_file(path);
+        } catch (const std::runtime_error& e) {
+            VTM_WARN(e.what());
+        }
+    }
+
+public:
+    // Virtual interfaces
+    // Maps the file, indexes its sections and parses the header. The other
+    // sections are parsed on first access and the mapping is kept until clear()
+    void parse_file(const string_view_t& path)
+    {
+        source_t source(path);
+        this->clear();
+
+        this->_source = std::move(source);
+        this->_index = index_t::build(this->_source.view());
+
+        try {
+            this->ensure_parsed(section_t::header);
+        } catch (...) {
+            this->clear();
+            throw;
+        }
+    }
+
+    // Writes the session as a Pro Tools text export. The header and track
+    // listing are formatted from the data, sections without a data model are
+    // written straight from the parsed file, in file order and with its line
+    // endings. Formatted text is flushed every flush_size bytes, each flush is
+    // one gathered write of the buffer and the copied sections around it.
+    // The export goes to a temporary file next to path and is renamed over it
+    // once complete, so path may be the file this session was parsed from
+    void write_file(const string_view_t& path) const
+    {
+        this->write_file(path, default_flush_size);
+    }
+
+    void write_file(const string_view_t& path, const std::size_t flush_size) const
+    {
+        this->ensure_parsed(section_t::track_listing);
+
+        const std::string_view source = this->_source.view();
+        const writer_t writer(this->_data, avidpt_newline_of(source));
+
+        // Sections by position, a session never parsed gets a header only
+        std::vector<section_t> order;
+        for (std::size_t i = 0; i < index_t::count; ++i) {
+            if (this->_index.contains(section_t(i))) order.push_back(section_t(i));
+        }
+        std::ranges::sort(order, {}, [this](const section_t section) { return this->_index.range(section).begin; });
+        if (order.empty()) order.push_back(section_t::header);
+
+        // Pieces are either a range of out or a view into the source
+        struct piece
+        {
+            std::string_view source;
+            std::size_t begin = 0;
+            std::size_t size = 0;
+        };
+
+        // Copied sections are read from the mapping of the source, which
+        // keeps the replaced file alive until this session is closed
+        const std::string target(path);
+        const std::string temp_path = fmt::format("{}.{:08x}.tmp", target, std::random_device{}());
+        try {
+            vtm::utility::internal::__FileWriter file(temp_path);
+            fmt::memory_buffer out;
+            out.reserve(std::min(flush_size, source.size()) + (std::size_t(1) << 16));
+            std::vector<piece> pieces;
+            std::size_t formatted = 0;
+
+            const auto cut = [&]() {
+                if (out.size() > formatted) pieces.push_back(piece{ {}, formatted, out.size() - formatted });
+                formatted = out.size();
+            };
+
+            const auto flush = [&](fmt::memory_buffer&) {
+                cut();
+                std::vector<std::string_view> views;
+                views.reserve(pieces.size());
+                for (const auto& p : pieces) views.push_back(p.source.data() ? p.source : std::string_view(out.data() + p.begin, p.size));
+
+                file.write(views);
+                pieces.clear();
+                out.clear();
+                formatted = 0;
+            };
+
+            std::size_t cursor = 0;
+            for (const section_t section : order) {
+                const auto& range = this->_index.range(section);
+                switch (section) {
+                    case section_t::header:        writer.write_header(out); break;
+                    case section_t::track_listing: writer.write_tracks(out, flush, flush_size); break;
+                    default:
+                        cut();
+                        pieces.push_back(piece{ source.substr(cursor, range.end - cursor) });
+                        break;
+                }
+                cursor = range.end;
+            }
+
+            flush(out);
+            file.close();
+            std::filesystem::rename(std::filesystem::path(temp_path), std::filesystem::path(target));
+        } catch (...) {
+            std::error_code ec;
+            std::filesystem::remove(std::filesystem::path(temp_path), ec);
+            throw;
+        }
+    }
+
+    virtual auto clear() noexcept -> void
+    {
+        this->_data.clear();
+        this->_source.close();
+        this->_index = index_t{};
+        this->_parsed = {};
+        this->_track_names.clear();
+        this->_event_names.clear();
+        this->_event_times.clear();
+    }
+    
+    virtual auto display() const noexcept -> display_t
+    {
+        VTM_TODO("not implemented");
+    }
+    
+    // Member access
+    // Name lookups parse the track listing on first access and are answered
+    // from indexes built with it. Matches are in file order
+    auto find_tracks(const std::string_view& name) const -> std::span<const std::size_t>
+    {
+        this->ensure_parsed(section_t::track_listing);
+        return this->_track_names.find(name);
+    }
+
+    auto find_events(const std::string_view& name) const -> std::span<const event_ref_t>
+    {
+        this->ensure_parsed(section_t::track_listing);
+        return this->_event_names.find(name);
+    }
+
+    // Events overlapping [begin, end) across every track, or playing at begin
+    // when end == begin. Events already playing at begin come first, then those
+    // starting in the range in start time order. Answered from an index built
+    // with the track listing, at the precision the events are stored in
+    auto events_in_range(const timecode_t begin, const timecode_t end) const -> std::vector<event_ref_t>
+    {
+        std::vector<event_ref_t> out;
+        this->events_in_range(begin, end, out);
+        return out;
+    }
+
+    auto events_in_range(const timecode_t begin, const timecode_t end, std::vector<event_ref_t>& out) const -> void
+    {
+        this->ensure_parsed(section_t::track_listing);
+        this->_event_times.find(static_cast<range_time_t>(begin), static_cast<range_time_t>(end), out);
+    }
+
+    // First track named name, throws std::out_of_range when there is none
+    auto get_track(const std::string_view& name) const -> const track_t&
+    {
+        const auto found = this->find_tracks(name);
+        if (found.empty()) throw std::out_of_range(fmt::format("no track named \"{}\"", name));
+        return this->_data.tracks[found.front()].second;
+    }
+
+    auto operator[](const std::size_t index) const -> const track_t&
+    {
+        return this->tracks().at(index).second;
+    }
+
+    // First event named name, throws std::out_of_range when there is none.
+    // Columnar events are rows read back by value
+    auto get_event(const std::string_view& name) const -> event_result_t
+    {
+        const auto found = this->find_events(name);
+        if (found.empty()) throw std::out_of_range(fmt::format("no event named \"{}\"", name));
+        return this->_data.tracks[found.front().track].second.events[found.front().event].second;
+    }
+
+    // Header fields only, no section past the header is parsed
+    auto session() const noexcept -> const data_t&
+    {
+        return this->_data;
+    }
+
+    // Parses the track listing on first access
+    auto tracks() const -> const typename data_t::data_t&
+    {
+        this->ensure_parsed(section_t::track_listing);
+        return this->_data.tracks;
+    }
+
+    // Parses every pending section
+    auto data() const -> const data_t&
+    {
+        this->ensure_parsed(section_t::track_listing);
+        return this->_data;
+    }
+
+    auto has_section(const section_t section) const noexcept -> bool
+    {
+        return this->_index.contains(section);
+    }
+
+    auto is_parsed(const section_t section) const noexcept -> bool
+    {
+        return section != section_t::none && this->_parsed[std::size_t(section)];
+    }
+
+    // Pool the track listing is parsed on, null parses on the calling thread.
+    // The pool must outlive every lazy parse of this object
+    auto set_thread_pool(vtm::utility::internal::__ThreadPool* pool) noexcept -> void
+    {
+        this->_pool = pool;
+    }
+
+    // Raw text of a section, for sections without a data model
+    auto section_text(const section_t section) const noexcept -> string_view_t
+    {
+        return string_view_t(this->_index.text(this->_source.view(), section));
+    }
+
+    // Raw text of the whole parsed file
+    auto source_text() const noexcept -> string_view_t
+    {
+        return string_view_t(this->_source.view());
+    }
+
+private:
+    // Lazy parsing is not synchronised, share a parsed object across threads
+    // only after the sections they read have been accessed once
+    auto ensure_parsed(const section_t section) const -> void
+    {
+        if (!this->_index.contains(section) || this->_parsed[std::size_t(section)]) return;
+
+        try {
+            parser_t(this->_data, this->_pool).parse_section(this->_source.view(), this->_index, section);
+        } catch (...) {
+            this->_data.tracks.clear();
+            throw;
+        }
+
+        if (section == section_t::track_listing) {
+            this->index_names();
+            this->index_times();
+        }
+        this->_parsed[std::size_t(section)] = true;
+    }
+
+    auto index_names() const -> void
+    {
+        const auto& tracks = this->_data.tracks;
+        std::size_t events = 0;
+        for (const auto& [i, track] : tracks) events += track.events.size();
+
+        this->_track_names.reserve(tracks.size());
+        this->_event_names.reserve(events);
+        for (std::size_t t = 0; t < tracks.size(); ++t) {
+            const auto& track = tracks[t].second;
+            this->_track_names.insert(track.name, t);
+
+            if constexpr (requires { track.events.name(0); }) {
+                for (std::size_t e = 0; e < track.events.size(); ++e) this->_event_names.insert(track.events.name(e), event_ref_t{ t, e });
+            } else {
+                for (std::size_t e = 0; e < track.events.size(); ++e) this->_event_names.insert(track.events[e].second.name, event_ref_t{ t, e });
+            }
+        }
+
+        this->_track_names.finish();
+        this->_event_names.finish();
+    }
+
+    auto index_times() const -> void
+    {
+        const auto& tracks = this->_data.tracks;
+        std::size_t events = 0;
+        for (const auto& [i, track] : tracks) events += track.events.size();
+
+        this->_event_times.reserve(events);
+        for (std::size_t t = 0; t < tracks.size(); ++t) {
+            const auto& track = tracks[t].second;
+            if constexpr (requires { track.events.start_times(); }) {
+                const auto starts = track.events.start_times();
+                const auto ends = track.events.end_times();
+                for (std::size_t e = 0; e < starts.size(); ++e) this->_event_times.insert(starts[e], ends[e], event_ref_t{ t, e });
+            } else {
+                for (std::size_t e = 0; e < track.events.size(); ++e) {
+                    const auto& event = track.events[e].second;
+                    this->_event_times.insert(event.start_time, event.end_time, event_ref_t{ t, e });
+                }
+            }
+        }
+
+        this->_event_times.finish();
+    }
+
+private:
+    mutable data_t _data;
+    mutable std::array<bool, index_t::count> _parsed{};
+    mutable __AvidPTNameIndex<std::size_t> _track_names;
+    mutable __AvidPTNameIndex<event_ref_t> _event_names;
+    mutable __AvidPTIntervalIndex<range_time_t, event_ref_t> _event_times;
+    source_t _source;
+    index_t _index;
+    vtm::utility::internal::__ThreadPool* _pool = nullptr;
+};
+
+} // @END OF namespace vtm::edl::internal
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace vtm {
+
+    // Avid Pro Tools EDL file parser
+    using avidpt_edl = edl::internal::__AvidPTEDLFile< std::string,
+                                                       std::string_view >;
+
+    // Avid Pro Tools EDL file parser, strings view the mapped file and stay
+    // valid until the object is cleared, reparsed or destroyed
+    using avidpt_edl_view = edl::internal::__AvidPTEDLFile< std::string,
+                                                            std::string_view,
+                                                            edl::internal::EDLFile<std::string, std::string_view>,
+                                                            edl::internal::__AvidPTEDLData<std::string_view, std::string_view> >;
+
+    // Avid Pro Tools EDL file parser, strings are interned in an arena owned
+    // by the parsed data and released together on clear()
+    using avidpt_edl_arena = edl::internal::__AvidPTEDLFile< std::string,
+                                                             std::string_view,
+                                                             edl::internal::EDLFile<std::string, std::string_view>,
+                                                             edl::internal::__AvidPTEDLArenaData<std::string_view> >;
+
+    // Avid Pro Tools EDL file parser, events are stored column by column for
+    // scans over time ranges. Event rows read back by value
+    using avidpt_edl_columnar = edl::internal::__AvidPTEDLFile< std::string,
+                                                                std::string_view,
+                                                                edl::internal::EDLFile<std::string, std::string_view>,
+                                                                edl::internal::__AvidPTEDLColumnarData<std::string, std::string_view> >;
+} // @END OF namespace vtm
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace vtm::edl {
+
+    inline constexpr std::size_t default_stream_chunk_size = std::size_t(1) << 16;
+
+    // Streams a Pro Tools export through visitor, reading chunk_size bytes at
+    // a time. See __AvidPTEDLStreamParser for the callbacks
+    template<typename TVisitor>
+    auto parse_stream(vtm::utility::internal::__FileReader& reader, TVisitor& visitor,
+                      const std::size_t chunk_size = default_stream_chunk_size) -> void
+    {
+        std::string buffer(std::max<std::size_t>(chunk_size, 1), '\0');
+        internal::__AvidPTEDLStreamParser<TVisitor> parser(visitor);
+        for (std::size_t got = reader.read(buffer); got > 0; got = reader.read(buffer)) {
+            parser.feed(std::string_view(buffer.data(), got));
+        }
+
+        parser.finish();
+    }
+
+    template<typename TVisitor>
+    auto parse_stream(const std::string_view path, TVisitor& visitor, const std::size_t chunk_size = default_stream_chunk_size) -> void
+    {
+        vtm::utility::internal::__FileReader reader(path);
+        parse_stream(reader, visitor, chunk_size);
+    }
+
+    // Reads fd from its current position to the end, fd is left open
+    template<typename TVisitor>
+    auto parse_stream(const int fd, TVisitor& visitor, const std::size_t chunk_size = default_stream_chunk_size) -> void
+    {
+        vtm::utility::internal::__FileReader reader(fd);
+        parse_stream(reader, visitor, chunk_size);
+    }
+
+
+    struct ingest_options
+    {
+        // Pool the files are parsed on, null creates one of threads workers
+        // for the call
+        vtm::utility::internal::__ThreadPool* pool = nullptr;
+        std::size_t threads = vtm::utility::internal::__ThreadPool::default_workers();
+
+        // Files at least this large parse their track listing as one task
+        // per track block, smaller files are one task each
+        std::size_t split_size = std::size_t(4) << 20;
+    };
+
+    // One ingested file. On failure edl is empty and error holds the message
+    // its parse threw
+    template<typename TEDL>
+    struct ingest_result
+    {
+        std::string path;
+        TEDL edl;
+        std::string error;
+
+        auto ok() const noexcept -> bool
+        {
+            return this->error.empty();
+        }
+    };
+
+    // Parses every file of paths, header and track listing, on a thread pool.
+    // Files are started largest first and handed out one at a time, so a
+    // long file never starts last while the other workers go idle. Results
+    // are in the order of paths, and a file that fails does not stop the rest
+    template<typename TEDL = vtm::avidpt_edl, std::ranges::forward_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, std::string_view>
+    auto ingest(const R& paths, const ingest_options& options = {}) -> std::vector<ingest_result<TEDL>>
+    {
+        // Parsed files are not movable, results are built in place
+        std::vector<ingest_result<TEDL>> results(std::size_t(std::ranges::distance(paths)));
+        std::size_t next = 0;
+        for (const auto& path : paths) results[next++].path = std::string(std::string_view(path));
+
+        // Unreadable files sort last and report their error from the parse
+        std::vector<std::pair<std::uintmax_t, std::size_t>> order;
+        order.reserve(results.size());
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            std::error_code ec;
+            const std::uintmax_t size = std::filesystem::file_size(std::filesystem::path(results[i].path), ec);
+            order.emplace_back(ec ? 0 : size, i);
+        }
+        std::ranges::stable_sort(order, std::greater<>{}, [](const auto& file) { return file.first; });
+
+        std::optional<vtm::utility::internal::__ThreadPool> owned;
+        vtm::utility::internal::__ThreadPool* pool = options.pool ? options.pool : &owned.emplace(options.threads);
+
+        pool->parallel_for(order.size(), [&](const std::size_t i) {
+            auto& result = results[order[i].second];
+            try {
+                if (order[i].first >= options.split_size) result.edl.set_thread_pool(pool);
+                result.edl.parse_file(result.path);
+                (void)result.edl.data();
+            } catch (const std::exception& e) {
+                result.edl.clear();
+                result.error = e.what();
+            }
+
+            result.edl.set_thread_pool(nullptr);
+        });
+
+        return results;
+    }
+
+} // @END OF namespace vtm::edl
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
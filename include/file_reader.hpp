@@ -0,0 +1,155 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Sequential file reads into caller owned buffers
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Platform headers
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Library headers
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __FileReader --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility::internal {
+
+// Reads a file front to back through a file descriptor. Opened from a path the
+// descriptor is owned and closed with the reader, adopted descriptors are left
+// open. Pipes and sockets work as well as regular files
+class __FileReader
+{
+public:
+    __FileReader() = default;
+
+    explicit __FileReader(const std::string_view path)
+    {
+        this->open(path);
+    }
+
+    // Reads from fd without taking ownership
+    explicit __FileReader(const int fd) noexcept
+        : _fd(fd)
+    {}
+
+    __FileReader(const __FileReader&) = delete;
+    __FileReader& operator=(const __FileReader&) = delete;
+
+    __FileReader(__FileReader&& rhs) noexcept
+        : _fd(std::exchange(rhs._fd, -1))
+        , _owned(std::exchange(rhs._owned, false))
+    {}
+
+    __FileReader& operator=(__FileReader&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            this->close();
+            this->_fd = std::exchange(rhs._fd, -1);
+            this->_owned = std::exchange(rhs._owned, false);
+        }
+
+        return *this;
+    }
+
+    ~__FileReader() noexcept
+    {
+        this->close();
+    }
+
+    auto open(const std::string_view path) -> void
+    {
+        this->close();
+        const std::string cpath(path);
+
+#if defined(_WIN32)
+        const int fd = ::_open(cpath.c_str(), _O_RDONLY | _O_BINARY | _O_SEQUENTIAL);
+#else
+        const int fd = ::open(cpath.c_str(), O_RDONLY);
+#endif
+        if (fd < 0) throw std::runtime_error(fmt::format("could not open file at specified path: {}", path));
+
+        this->_fd = fd;
+        this->_owned = true;
+    }
+
+    auto close() noexcept -> void
+    {
+#if defined(_WIN32)
+        if (this->_owned) ::_close(this->_fd);
+#else
+        if (this->_owned) ::close(this->_fd);
+#endif
+        this->_fd = -1;
+        this->_owned = false;
+    }
+
+    // Fills out from the current position, fewer bytes only at the end of the
+    // file. Returns the count read, 0 once the file is exhausted
+    auto read(const std::span<char> out) -> std::size_t
+    {
+        std::size_t total = 0;
+        while (total < out.size()) {
+            const std::size_t want = out.size() - total;
+#if defined(_WIN32)
+            const int got = ::_read(this->_fd, out.data() + total, static_cast<unsigned>(std::min<std::size_t>(want, 1u << 30)));
+#else
+            const ssize_t got = ::read(this->_fd, out.data() + total, want);
+            if (got < 0 && errno == EINTR) continue;
+#endif
+            if (got < 0) throw std::runtime_error(fmt::format("read failed: {}", std::strerror(errno)));
+            if (got == 0) break;
+            total += std::size_t(got);
+        }
+
+        return total;
+    }
+
+    auto is_open() const noexcept -> bool
+    {
+        return this->_fd >= 0;
+    }
+
+private:
+    int _fd = -1;
+    bool _owned = false;
+};
+
+} // @END OF namespace vtm::utility::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility {
+
+using file_reader = internal::__FileReader;
+
+} // @END OF namespace vtm::utility
+
+///////////////////////////////////////////////////////////////////////////
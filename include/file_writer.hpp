@@ -0,0 +1,174 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Gathered file writes from caller owned buffers
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Platform headers
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <climits>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// Library headers
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __FileWriter --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility::internal {
+
+// Writes a file front to back, truncating it on open. write() takes any number
+// of buffers and hands them to the kernel together where the platform allows,
+// so formatted and borrowed text go out without being copied into one buffer
+class __FileWriter
+{
+public:
+    __FileWriter() = default;
+
+    explicit __FileWriter(const std::string_view path)
+    {
+        this->open(path);
+    }
+
+    __FileWriter(const __FileWriter&) = delete;
+    __FileWriter& operator=(const __FileWriter&) = delete;
+
+    __FileWriter(__FileWriter&& rhs) noexcept
+        : _fd(std::exchange(rhs._fd, -1))
+    {}
+
+    __FileWriter& operator=(__FileWriter&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            this->close();
+            this->_fd = std::exchange(rhs._fd, -1);
+        }
+
+        return *this;
+    }
+
+    ~__FileWriter() noexcept
+    {
+        this->close();
+    }
+
+    auto open(const std::string_view path) -> void
+    {
+        this->close();
+        const std::string cpath(path);
+
+#if defined(_WIN32)
+        const int fd = ::_open(cpath.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+        const int fd = ::open(cpath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+        if (fd < 0) throw std::runtime_error(fmt::format("could not open file for writing at specified path: {}", path));
+
+        this->_fd = fd;
+    }
+
+    auto close() noexcept -> void
+    {
+#if defined(_WIN32)
+        if (this->_fd >= 0) ::_close(this->_fd);
+#else
+        if (this->_fd >= 0) ::close(this->_fd);
+#endif
+        this->_fd = -1;
+    }
+
+    // Writes every buffer in order, retrying short writes
+    auto write(std::span<const std::string_view> buffers) -> void
+    {
+#if defined(_WIN32)
+        for (std::string_view buffer : buffers) {
+            while (!buffer.empty()) {
+                const int wrote = ::_write(this->_fd, buffer.data(), static_cast<unsigned>(std::min<std::size_t>(buffer.size(), 1u << 30)));
+                if (wrote < 0) throw std::runtime_error(fmt::format("write failed: {}", std::strerror(errno)));
+                buffer.remove_prefix(std::size_t(wrote));
+            }
+        }
+#else
+        constexpr std::size_t max_iov = IOV_MAX < 1024 ? IOV_MAX : 1024;
+        iovec iov[max_iov];
+
+        std::size_t next = 0;
+        std::size_t skip = 0; // Bytes of buffers[next] already written
+        while (next < buffers.size()) {
+            std::size_t count = 0;
+            for (std::size_t i = next; i < buffers.size() && count < max_iov; ++i) {
+                const std::size_t offset = i == next ? skip : 0;
+                if (buffers[i].size() == offset) continue;
+                iov[count++] = iovec{ const_cast<char*>(buffers[i].data() + offset), buffers[i].size() - offset };
+            }
+            if (count == 0) break;
+
+            const ssize_t wrote = ::writev(this->_fd, iov, int(count));
+            if (wrote < 0 && errno == EINTR) continue;
+            if (wrote < 0) throw std::runtime_error(fmt::format("write failed: {}", std::strerror(errno)));
+
+            // Advance past what was written, possibly ending inside a buffer
+            std::size_t left = std::size_t(wrote);
+            while (next < buffers.size() && left >= buffers[next].size() - skip) {
+                left -= buffers[next].size() - skip;
+                skip = 0;
+                ++next;
+            }
+            skip += left;
+        }
+#endif
+    }
+
+    auto write(const std::string_view buffer) -> void
+    {
+        this->write(std::span<const std::string_view>(&buffer, 1));
+    }
+
+    auto is_open() const noexcept -> bool
+    {
+        return this->_fd >= 0;
+    }
+
+private:
+    int _fd = -1;
+};
+
+} // @END OF namespace vtm::utility::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility {
+
+using file_writer = internal::__FileWriter;
+
+} // @END OF namespace vtm::utility
+
+///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,209 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Read-only memory mapped files
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Platform headers
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Library headers
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __MappedFile --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility::internal {
+
+// Whole file mapped read-only into memory. The contents are exposed as a
+// string_view which stays valid until the mapping is closed or the object is
+// destroyed. Empty files are open with an empty view
+class __MappedFile
+{
+public:
+    __MappedFile() = default;
+
+    explicit __MappedFile(const std::string_view path)
+    {
+        this->open(path);
+    }
+
+    ~__MappedFile() noexcept
+    {
+        this->close();
+    }
+
+    __MappedFile(const __MappedFile&) = delete;
+    __MappedFile& operator=(const __MappedFile&) = delete;
+
+    __MappedFile(__MappedFile&& rhs) noexcept
+        : _data(std::exchange(rhs._data, nullptr))
+        , _size(std::exchange(rhs._size, 0))
+        , _open(std::exchange(rhs._open, false))
+    {}
+
+    __MappedFile& operator=(__MappedFile&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            this->close();
+            this->_data = std::exchange(rhs._data, nullptr);
+            this->_size = std::exchange(rhs._size, 0);
+            this->_open = std::exchange(rhs._open, false);
+        }
+
+        return *this;
+    }
+
+public:
+    // Throws std::runtime_error if the file cannot be opened or mapped
+    auto open(const std::string_view path) -> void
+    {
+        this->close();
+
+        // Mapping APIs need a null terminated path
+        const std::string cpath(path);
+
+#if defined(_WIN32)
+        const HANDLE file = ::CreateFileA(cpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            throw std::runtime_error(fmt::format("could not open file at specified path: {}", path));
+
+        LARGE_INTEGER size{};
+        if (!::GetFileSizeEx(file, &size)) {
+            ::CloseHandle(file);
+            throw std::runtime_error(fmt::format("could not read size of file at specified path: {}", path));
+        }
+
+        if (size.QuadPart > 0) {
+            const HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            ::CloseHandle(file);
+            if (mapping == nullptr)
+                throw std::runtime_error(fmt::format("could not map file at specified path: {}", path));
+
+            const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            ::CloseHandle(mapping);
+            if (view == nullptr)
+                throw std::runtime_error(fmt::format("could not map file at specified path: {}", path));
+
+            this->_data = static_cast<const char*>(view);
+            this->_size = static_cast<std::size_t>(size.QuadPart);
+        } else {
+            ::CloseHandle(file);
+        }
+#else
+        const int fd = ::open(cpath.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error(fmt::format("could not open file at specified path: {}", path));
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error(fmt::format("could not read size of file at specified path: {}", path));
+        }
+
+        if (st.st_size > 0) {
+            void* view = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (view == MAP_FAILED)
+                throw std::runtime_error(fmt::format("could not map file at specified path: {}", path));
+
+            // Parsers walk the file front to back
+            ::madvise(view, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+
+            this->_data = static_cast<const char*>(view);
+            this->_size = static_cast<std::size_t>(st.st_size);
+        } else {
+            ::close(fd);
+        }
+#endif
+
+        this->_open = true;
+    }
+
+    auto close() noexcept -> void
+    {
+        if (this->_data != nullptr) {
+#if defined(_WIN32)
+            ::UnmapViewOfFile(this->_data);
+#else
+            ::munmap(const_cast<char*>(this->_data), this->_size);
+#endif
+        }
+
+        this->_data = nullptr;
+        this->_size = 0;
+        this->_open = false;
+    }
+
+    auto view() const noexcept -> std::string_view
+    {
+        return std::string_view(this->_data, this->_size);
+    }
+
+    auto data() const noexcept -> const char*
+    {
+        return this->_data;
+    }
+
+    auto size() const noexcept -> std::size_t
+    {
+        return this->_size;
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return this->_size == 0;
+    }
+
+    auto is_open() const noexcept -> bool
+    {
+        return this->_open;
+    }
+
+private:
+    const char* _data = nullptr;
+    std::size_t _size = 0;
+    bool _open = false;
+};
+
+} // @END OF namespace vtm::utility::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility {
+
+using mapped_file = internal::__MappedFile;
+
+} // @END OF namespace vtm::utility
+
+///////////////////////////////////////////////////////////////////////////
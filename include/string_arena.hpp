@@ -0,0 +1,141 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Interned string storage with all-at-once release
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __StringArena --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility::internal {
+
+// Strings are copied into monotonic buffers and handed back as views, each
+// distinct string is stored once. Nothing is freed until clear() or
+// destruction, which release every buffer at once. Strings are spread over
+// shards by hash, each behind its own lock, so concurrent parsers rarely
+// contend. Views stay valid until clear()
+class __StringArena
+{
+public:
+    static constexpr std::size_t default_shards = 16;
+
+    __StringArena()
+        : __StringArena(default_shards)
+    {}
+
+    explicit __StringArena(const std::size_t shards)
+    {
+        this->_shards.resize(shards > 0 ? shards : 1);
+        for (auto& owner : this->_shards) owner = std::make_unique<shard>();
+    }
+
+    __StringArena(const __StringArena&) = delete;
+    __StringArena(__StringArena&&) noexcept = default;
+    __StringArena& operator=(const __StringArena&) = delete;
+    __StringArena& operator=(__StringArena&&) noexcept = default;
+    ~__StringArena() = default;
+
+    // Stored copy of s, equal strings share one copy. Thread safe
+    auto intern(const std::string_view s) -> std::string_view
+    {
+        if (s.empty()) return {};
+
+        const std::size_t hash = std::hash<std::string_view>{}(s);
+        shard& owner = *this->_shards[hash % this->_shards.size()];
+        std::lock_guard lock(owner.mutex);
+
+        if (const auto found = owner.strings.find(s); found != owner.strings.end()) return *found;
+
+        char* copy = static_cast<char*>(owner.memory.allocate(s.size(), 1));
+        std::memcpy(copy, s.data(), s.size());
+        owner.bytes += s.size();
+        return *owner.strings.emplace(copy, s.size()).first;
+    }
+
+    // Releases every stored string, views handed out before are dangling
+    auto clear() noexcept -> void
+    {
+        for (auto& owner : this->_shards) {
+            std::lock_guard lock(owner->mutex);
+            owner->reset();
+        }
+    }
+
+    // Count of distinct strings stored
+    auto size() const -> std::size_t
+    {
+        std::size_t count = 0;
+        for (const auto& owner : this->_shards) {
+            std::lock_guard lock(owner->mutex);
+            count += owner->strings.size();
+        }
+
+        return count;
+    }
+
+    // Bytes of string data stored, excluding the lookup tables
+    auto bytes() const -> std::size_t
+    {
+        std::size_t total = 0;
+        for (const auto& owner : this->_shards) {
+            std::lock_guard lock(owner->mutex);
+            total += owner->bytes;
+        }
+
+        return total;
+    }
+
+private:
+    // The lookup table allocates from the same buffers, so it is declared
+    // after them and destroyed first
+    struct shard
+    {
+        mutable std::mutex mutex;
+        std::pmr::monotonic_buffer_resource memory;
+        std::pmr::unordered_set<std::string_view> strings{ &memory };
+        std::size_t bytes = 0;
+
+        // The empty table is rebuilt in place after the buffers are released
+        void reset() noexcept
+        {
+            std::destroy_at(&strings);
+            memory.release();
+            std::construct_at(&strings, &memory);
+            bytes = 0;
+        }
+    };
+
+    std::vector<std::unique_ptr<shard>> _shards;
+};
+
+} // @END OF namespace vtm::utility::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility {
+
+using string_arena = internal::__StringArena;
+
+} // @END OF namespace vtm::utility
+
+///////////////////////////////////////////////////////////////////////////
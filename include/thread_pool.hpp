@@ -0,0 +1,262 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Fixed size work stealing thread pool with a blocking parallel loop
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __ThreadPool --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility::internal {
+
+// Every worker owns a deque of tasks. Tasks submitted from a worker go to the
+// back of its own deque and are taken back LIFO while they are still warm in
+// its cache, tasks submitted from other threads go to a shared queue. An idle
+// worker takes from the shared queue and then steals from the front of the
+// other deques, oldest and usually largest work first. A pool of zero workers
+// is valid, parallel_for() then runs every index on the calling thread
+class __ThreadPool
+{
+public:
+    using task_t = std::function<void()>;
+
+    explicit __ThreadPool(const std::size_t workers = default_workers())
+    {
+        this->_queues.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i) this->_queues.push_back(std::make_unique<queue>());
+
+        this->_workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i) {
+            this->_workers.emplace_back([this, i]() { this->run(i); });
+        }
+    }
+
+    ~__ThreadPool() noexcept
+    {
+        {
+            std::lock_guard lock(this->_mutex);
+            this->_stopping = true;
+        }
+
+        this->_wake.notify_all();
+        for (auto& worker : this->_workers) worker.join();
+    }
+
+    __ThreadPool(const __ThreadPool&) = delete;
+    __ThreadPool(__ThreadPool&&) = delete;
+    __ThreadPool& operator=(const __ThreadPool&) = delete;
+    __ThreadPool& operator=(__ThreadPool&&) = delete;
+
+    // Hardware threads less the one calling parallel_for()
+    static auto default_workers() noexcept -> std::size_t
+    {
+        const std::size_t hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+
+    auto size() const noexcept -> std::size_t
+    {
+        return this->_workers.size();
+    }
+
+    // Fire and forget, the task must not throw. Tasks still queued when the
+    // pool is destroyed are run before the workers exit
+    auto submit(task_t task) -> void
+    {
+        const std::size_t self = this->worker_index();
+        queue& target = self < this->_queues.size() ? *this->_queues[self] : this->_shared;
+        {
+            std::lock_guard lock(target.mutex);
+            target.tasks.push_back(std::move(task));
+        }
+
+        // Counted under the sleep lock, a worker deciding to sleep either
+        // sees the task or is already waiting for this notify
+        {
+            std::lock_guard lock(this->_mutex);
+            ++this->_queued;
+        }
+        this->_wake.notify_one();
+    }
+
+    // Runs one queued task on the calling thread, false when none was queued
+    auto run_pending_task() -> bool
+    {
+        task_t task;
+        if (!this->take(this->worker_index(), task)) return false;
+
+        task();
+        return true;
+    }
+
+    // Calls body(i) for every i in [0, count) on the workers and the calling
+    // thread, returns once all calls are done. Indexes are handed out one at
+    // a time, so uneven bodies balance themselves. The first exception stops
+    // handing out indexes and is rethrown here. Nested loops are safe, a
+    // thread waiting for its helpers runs queued tasks until none are left,
+    // and the helpers it then waits for are already running
+    template<typename F>
+    auto parallel_for(const std::size_t count, F&& body) -> void
+    {
+        struct loop_state
+        {
+            std::atomic<std::size_t> next{0};
+            std::size_t helpers = 0;
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable done;
+        };
+
+        loop_state state;
+        const auto drain = [&]() {
+            for (std::size_t i = state.next++; i < count; i = state.next++) {
+                try {
+                    body(i);
+                } catch (...) {
+                    std::lock_guard lock(state.mutex);
+                    if (!state.error) state.error = std::current_exception();
+                    state.next = count;
+                }
+            }
+        };
+
+        const std::size_t helpers = count > 1 ? std::min(this->size(), count - 1) : 0;
+        state.helpers = helpers;
+        for (std::size_t i = 0; i < helpers; ++i) {
+            this->submit([&]() {
+                drain();
+                std::lock_guard lock(state.mutex);
+                if (--state.helpers == 0) state.done.notify_one();
+            });
+        }
+
+        drain();
+
+        const auto finished = [&]() {
+            std::lock_guard lock(state.mutex);
+            return state.helpers == 0;
+        };
+        while (!finished() && this->run_pending_task()) {}
+
+        std::unique_lock lock(state.mutex);
+        state.done.wait(lock, [&]() { return state.helpers == 0; });
+        if (state.error) std::rethrow_exception(state.error);
+    }
+
+private:
+    struct queue
+    {
+        std::mutex mutex;
+        std::deque<task_t> tasks;
+    };
+
+    // Index of the calling thread among this pool's workers, size() for any
+    // other thread
+    auto worker_index() const noexcept -> std::size_t
+    {
+        const auto& current = this_worker();
+        return current.pool == this ? current.index : this->_queues.size();
+    }
+
+    struct worker_identity
+    {
+        const __ThreadPool* pool = nullptr;
+        std::size_t index = 0;
+    };
+
+    static auto this_worker() noexcept -> worker_identity&
+    {
+        static thread_local worker_identity identity;
+        return identity;
+    }
+
+    // Own deque from the back, then the shared queue, then the other deques
+    // from the front
+    auto take(const std::size_t self, task_t& task) -> bool
+    {
+        const auto pop = [&](queue& from, const bool back) {
+            std::lock_guard lock(from.mutex);
+            if (from.tasks.empty()) return false;
+
+            if (back) {
+                task = std::move(from.tasks.back());
+                from.tasks.pop_back();
+            } else {
+                task = std::move(from.tasks.front());
+                from.tasks.pop_front();
+            }
+            return true;
+        };
+
+        const std::size_t count = this->_queues.size();
+        bool found = (self < count && pop(*this->_queues[self], true)) || pop(this->_shared, false);
+        for (std::size_t k = 1; !found && k <= count; ++k) {
+            const std::size_t victim = (self + k) % count;
+            found = victim != self && pop(*this->_queues[victim], false);
+        }
+
+        if (found) --this->_queued;
+        return found;
+    }
+
+    auto run(const std::size_t self) -> void
+    {
+        this_worker() = worker_identity{ this, self };
+
+        for (;;) {
+            task_t task;
+            if (this->take(self, task)) {
+                task();
+                continue;
+            }
+
+            std::unique_lock lock(this->_mutex);
+            this->_wake.wait(lock, [this]() { return this->_stopping || this->_queued > 0; });
+            if (this->_stopping && this->_queued == 0) return;
+        }
+    }
+
+private:
+    std::vector<std::thread> _workers;
+    std::vector<std::unique_ptr<queue>> _queues;
+    queue _shared;
+    std::atomic<std::size_t> _queued{0};
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    bool _stopping = false;
+};
+
+} // @END OF namespace vtm::utility::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::utility {
+
+using thread_pool = internal::__ThreadPool;
+
+} // @END OF namespace vtm::utility
+
+///////////////////////////////////////////////////////////////////////////
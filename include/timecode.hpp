@@ -7,10 +7,26 @@
 
 ///////////////////////////////////////////////////////////////////////////
 
+// Standard headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+// Third-party headers
+#include <fmt/format.h>
+
 // Library headers
 #include "timecode_common.hpp"
 #include "timecode_int.hpp"
 #include "timecode_float.hpp"
+#include "timecode_rational.hpp"
+#include "timecode_fixed.hpp"
+#include "timecode_dense.hpp"
+#include "timecode_batch.hpp"
+#include "timecode_column.hpp"
+#include "timecode_sort.hpp"
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -44,6 +60,106 @@ using f64timecode = internal::__BasicTimecodeFloat<std::string,
                                                    float64_t,
                                                    fps>;
 
+using r64timecode = internal::__BasicTimecodeRational<int64_t,
+                                                      float64_t,
+                                                      std::string,
+                                                      std::string_view,
+                                                      fps>;
+
+template<fps::type Rate>
+using fixed_timecode = internal::__BasicTimecodeFixed<int64_t,
+                                                      float64_t,
+                                                      std::string,
+                                                      std::string_view,
+                                                      fps,
+                                                      Rate>;
+
+using dense_timecode = internal::__BasicTimecodeDense<std::string,
+                                                      std::string_view,
+                                                      int64_t,
+                                                      float64_t,
+                                                      fps>;
+
+using timecode_column = internal::__BasicTimecodeColumn<f64timecode>;
+
+static_assert(internal::DenseTimecode<dense_timecode>, "dense_timecode must be trivially copyable and at most 16 bytes");
+
+// @SECTION: Label preserving conversions between floating point and exact timecodes
+inline auto to_r64timecode(const f64timecode& tc) -> r64timecode
+{
+    return r64timecode::from_ticks(tc.as_float(), tc.fps());
+}
+
+inline auto to_f64timecode(const r64timecode& tc) -> f64timecode
+{
+    return f64timecode{ tc.as_float(), tc.fps() };
+}
+
+// @SECTION: Conversions between runtime and compile-time frame rate timecodes
+template<fps::type Rate>
+inline auto to_f64timecode(const fixed_timecode<Rate>& tc) -> f64timecode
+{
+    return f64timecode{ tc.as_float(), Rate };
+}
+
+template<fps::type Rate>
+inline auto to_fixed_timecode(const f64timecode& tc) -> fixed_timecode<Rate>
+{
+    VTM_ASSERT(tc.fps() == Rate, "frame rate of timecode does not match fixed frame rate");
+    return fixed_timecode<Rate>{ tc.as_float() };
+}
+
+// @SECTION: Conversions between virtual and dense timecodes
+inline auto to_dense_timecode(const f64timecode& tc) -> dense_timecode
+{
+    return dense_timecode{ tc.as_float(), tc.fps() };
+}
+
+inline auto to_f64timecode(const dense_timecode& tc) -> f64timecode
+{
+    return f64timecode{ tc.as_float(), tc.fps() };
+}
+
+// @SECTION: Batch conversions by frame rate format
+inline auto parse_timecodes(std::span<const std::string_view> in,
+                            const fps::type rate,
+                            std::span<fps::float_type> out,
+                            std::span<std::uint64_t> invalid = {}) -> std::size_t
+{
+    return parse_timecodes(in, fps::to_float(rate), fps::is_drop_frame(rate), out, invalid);
+}
+
+inline auto format_timecodes(std::span<const fps::float_type> in,
+                             const fps::type rate,
+                             char* out,
+                             std::span<std::uint64_t> invalid = {}) -> std::size_t
+{
+    return format_timecodes(in, fps::to_float(rate), fps::is_drop_frame(rate), out, invalid);
+}
+
+// @SECTION: Timecode literals, parsed and validated at compile time
+inline namespace literals {
+
+template<tcliteral Tc>
+inline auto operator""_tc24() -> f64timecode { return f64timecode::from_string<Tc, fps::fps_24>(); }
+
+template<tcliteral Tc>
+inline auto operator""_tc25() -> f64timecode { return f64timecode::from_string<Tc, fps::fps_25>(); }
+
+template<tcliteral Tc>
+inline auto operator""_tc2997() -> f64timecode { return f64timecode::from_string<Tc, fps::fps_29p97>(); }
+
+template<tcliteral Tc>
+inline auto operator""_tc2997df() -> f64timecode { return f64timecode::from_string<Tc, fps::fpsdf_29p97>(); }
+
+template<tcliteral Tc>
+inline auto operator""_tc30() -> f64timecode { return f64timecode::from_string<Tc, fps::fps_30>(); }
+
+template<tcliteral Tc>
+inline auto operator""_tc60() -> f64timecode { return f64timecode::from_string<Tc, fps::fps_60>(); }
+
+} // @END OF namespace vtm::chrono::literals
+
 } // @END OF namespace vtm::chrono
 
 ///////////////////////////////////////////////////////////////////////////
@@ -60,12 +176,21 @@ namespace vtm {
 // @SECTION: VTM timecode object aliases
 using timecode = chrono::timecode;
 using f64timecode = chrono::f64timecode;
+using r64timecode = chrono::r64timecode;
+using dense_timecode = chrono::dense_timecode;
+using timecode_column = chrono::timecode_column;
+
+template<chrono::fps::type Rate>
+using fixed_timecode = chrono::fixed_timecode<Rate>;
 
 // @SECTION: VTM FPS factory object aliases
 using fps = chrono::fps;
 using fpsfloat_t = typename chrono::fps::float_type;
 using fpsint_t = typename chrono::fps::int_type;
 
+// @SECTION: VTM timecode literals, e.g. "01:00:00:00"_tc25
+namespace literals = chrono::literals;
+
 } // @END OF namespace vtm
 
 ///////////////////////////////////////////////////////////////////////////
@@ -90,6 +215,88 @@ struct tuple_element<Index, vtm::f64timecode>
                           typename vtm::f64timecode::__element2_type >>
 {};
 
+template<>
+struct tuple_size<vtm::dense_timecode> : std::integral_constant<std::size_t, 2> {};
+
+template<std::size_t Index>
+struct tuple_element<Index, vtm::dense_timecode>
+    : tuple_element<Index,
+                    tuple<typename vtm::dense_timecode::__element1_type,
+                          typename vtm::dense_timecode::__element2_type >>
+{};
+
 } // @END OF namespace std
 
 ///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Extensions to namespace fmt --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace fmt {
+
+// @SECTION: __BasicTimecodeFloat formatter, writes "HH:MM:SS:FF" without allocating
+template<>
+struct formatter<vtm::f64timecode>
+{
+    constexpr auto parse(format_parse_context& ctx) -> decltype(ctx.begin())
+    {
+        auto it = ctx.begin();
+        if (it != ctx.end() && *it != '}') throw format_error("invalid format specifier for timecode");
+        return it;
+    }
+
+    template<typename FormatContext>
+    auto format(const vtm::f64timecode& tc, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        tc.format_to(buffer);
+        return std::copy(buffer, buffer + VTM_TCSTRING_FIXED_SIZE, ctx.out());
+    }
+};
+
+// @SECTION: __BasicTimecodeRational formatter, writes "HH:MM:SS:FF" without allocating
+template<>
+struct formatter<vtm::r64timecode> : formatter<vtm::f64timecode>
+{
+    template<typename FormatContext>
+    auto format(const vtm::r64timecode& tc, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        tc.format_to(buffer);
+        return std::copy(buffer, buffer + VTM_TCSTRING_FIXED_SIZE, ctx.out());
+    }
+};
+
+// @SECTION: __BasicTimecodeFixed formatter, writes "HH:MM:SS:FF" without allocating
+template<vtm::fps::type Rate>
+struct formatter<vtm::chrono::fixed_timecode<Rate>> : formatter<vtm::f64timecode>
+{
+    template<typename FormatContext>
+    auto format(const vtm::chrono::fixed_timecode<Rate>& tc, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        tc.format_to(buffer);
+        return std::copy(buffer, buffer + VTM_TCSTRING_FIXED_SIZE, ctx.out());
+    }
+};
+
+// @SECTION: __BasicTimecodeDense formatter, writes "HH:MM:SS:FF" without allocating
+template<>
+struct formatter<vtm::dense_timecode> : formatter<vtm::f64timecode>
+{
+    template<typename FormatContext>
+    auto format(const vtm::dense_timecode& tc, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        tc.format_to(buffer);
+        return std::copy(buffer, buffer + VTM_TCSTRING_FIXED_SIZE, ctx.out());
+    }
+};
+
+} // @END OF namespace fmt
+
+///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,338 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Batch timecode conversion over contiguous spans
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+// Project headers
+#include "timecode_common.hpp"
+#include "timecode_dropframe.hpp"
+#include "timecode_float.hpp"
+#include "timecode_string.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Invalid Entry Bitmaps --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono {
+
+// Batch conversions never abort on bad input. Entry i is reported invalid by
+// setting bit (i % 64) of word (i / 64) in a caller-supplied bitmap
+constexpr auto tcbitmap_words(const std::size_t count) noexcept -> std::size_t
+{
+    return (count + 63) / 64;
+}
+
+constexpr auto tcbitmap_test(std::span<const std::uint64_t> bitmap, const std::size_t i) noexcept -> bool
+{
+    return (bitmap[i / 64] >> (i % 64)) & 1;
+}
+
+} // @END OF namespace vtm::chrono
+
+namespace vtm::chrono::internal {
+
+constexpr auto tcbitmap_set(std::span<std::uint64_t> bitmap, const std::size_t i) noexcept -> void
+{
+    if (!bitmap.empty()) bitmap[i / 64] |= std::uint64_t{1} << (i % 64);
+}
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+
+// @SECTION: AVX2 kernel, splits four tick values into fields in double lanes.
+// Mirrors ticks_to_fields(), every intermediate is an integer below 2^53 so
+// the floors are exact. Returns a four-bit mask of negative or non-finite inputs
+template<std::floating_point F>
+inline auto ticks_to_fields_avx2(const F* in, const double fps, const bool is_dropframe, tcstring_fields* out) noexcept -> unsigned
+{
+    __m256d n = _mm256_setr_pd(double(in[0]), double(in[1]), double(in[2]), double(in[3]));
+
+    // (n - n) is NaN for infinities and NaN, so one ordered compare covers both
+    const __m256d finite = _mm256_cmp_pd(_mm256_sub_pd(n, n), _mm256_setzero_pd(), _CMP_EQ_OQ);
+    const __m256d valid = _mm256_and_pd(finite, _mm256_cmp_pd(n, _mm256_setzero_pd(), _CMP_GE_OQ));
+    n = _mm256_and_pd(n, valid);
+
+    const __m256d vfps = _mm256_set1_pd(fps);
+    const __m256d secs = _mm256_mul_pd(n, _mm256_set1_pd(100.0));
+    const __m256d total = _mm256_floor_pd(_mm256_add_pd(secs, _mm256_set1_pd(0.5 / fps)));
+    const __m256d frames = _mm256_floor_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_sub_pd(secs, total), vfps), _mm256_set1_pd(0.5)));
+    const __m256d hours = _mm256_floor_pd(_mm256_div_pd(total, _mm256_set1_pd(3600.0)));
+    const __m256d rem = _mm256_sub_pd(total, _mm256_mul_pd(hours, _mm256_set1_pd(3600.0)));
+    const __m256d minutes = _mm256_floor_pd(_mm256_div_pd(rem, _mm256_set1_pd(60.0)));
+    const __m256d seconds = _mm256_sub_pd(rem, _mm256_mul_pd(minutes, _mm256_set1_pd(60.0)));
+
+    alignas(16) std::int32_t h[4], m[4], s[4], f[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(h), _mm256_cvttpd_epi32(hours));
+    _mm_store_si128(reinterpret_cast<__m128i*>(m), _mm256_cvttpd_epi32(minutes));
+    _mm_store_si128(reinterpret_cast<__m128i*>(s), _mm256_cvttpd_epi32(seconds));
+    _mm_store_si128(reinterpret_cast<__m128i*>(f), _mm256_cvttpd_epi32(_mm256_max_pd(frames, _mm256_setzero_pd())));
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        out[i] = tcstring_fields {
+            static_cast<std::uint32_t>(h[i]),
+            static_cast<std::uint32_t>(m[i]),
+            static_cast<std::uint32_t>(s[i]),
+            static_cast<std::uint32_t>(f[i]),
+            is_dropframe
+        };
+    }
+
+    return static_cast<unsigned>(~_mm256_movemask_pd(valid)) & 0b1111;
+}
+
+#endif // @END OF VTM_TIMECODE_SIMD_AVX2
+
+// Hour field wider than two digits, e.g. "100:00:00;00". The hours are parsed
+// on their own and the "MM:SS:FF" tail with the fixed-width parser, so the
+// delimiter rules match the fixed-width path
+inline auto parse_tcstring_wide(const std::string_view tc, tcstring_fields& out) noexcept -> bool
+{
+    constexpr std::size_t tail = VTM_TCSTRING_FIXED_SIZE - 2;
+    if (tc.size() <= VTM_TCSTRING_FIXED_SIZE) return false;
+
+    const std::string_view hours = tc.substr(0, tc.size() - tail);
+    std::uint32_t value = 0;
+    const auto [end, ec] = std::from_chars(hours.data(), hours.data() + hours.size(), value);
+    if (ec != std::errc{} || end != hours.data() + hours.size()) return false;
+
+    std::array<char, VTM_TCSTRING_FIXED_SIZE> fixed{ '0', '0' };
+    std::copy(tc.end() - tail, tc.end(), fixed.begin() + 2);
+    const char* const text = fixed.data();
+    if (!parse_tcstring_fixed(text, out)) return false;
+
+    out.hours = value;
+    return true;
+}
+
+} // @END OF namespace vtm::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Batch Parsing & Formatting --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono {
+
+// @SECTION: Parses in[i] into out[i] as ticks. Invalid entries are written as
+// zero and flagged in `invalid` (if non-empty, at least tcbitmap_words(in.size())
+// words). Returns the number of invalid entries
+template<std::floating_point F>
+inline auto parse_timecodes(std::span<const std::string_view> in,
+                            const F fps,
+                            const bool is_dropframe,
+                            std::span<F> out,
+                            std::span<std::uint64_t> invalid = {}) -> std::size_t
+{
+    VTM_ASSERT(out.size() >= in.size(), "output span is smaller than input span");
+    VTM_ASSERT(invalid.empty() || invalid.size() >= tcbitmap_words(in.size()), "invalid entry bitmap is too small");
+
+    const auto coefs = fps_to_ticks_by_chunk(fps);
+    const auto nominal = static_cast<std::uint64_t>(std::ceil(fps));
+    std::size_t invalid_count = 0;
+
+    for (auto& word : invalid.first(invalid.empty() ? 0 : tcbitmap_words(in.size()))) word = 0;
+
+    const auto reject = [&](std::size_t i) {
+        out[i] = 0.0;
+        internal::tcbitmap_set(invalid, i);
+        ++invalid_count;
+    };
+
+    const auto parse_one = [&](std::size_t i) {
+        const std::string_view tc = in[i];
+        tcstring_fields fields;
+
+        if (tc.size() == VTM_TCSTRING_FIXED_SIZE && is_dropframe) {
+            if (parse_tcstring_fixed(tc.data(), fields) && valid_dropframe_fields(fields, nominal)) {
+                out[i] = F(fields_to_dropframe(fields, nominal)) / fps / F(100.0);
+            }
+            else reject(i);
+        }
+
+        else if (tc.size() == VTM_TCSTRING_FIXED_SIZE) {
+            if (parse_tcstring_fixed(tc.data(), fields)) out[i] = fields_to_ticks(fields, coefs);
+            else reject(i);
+        }
+
+        // Wide drop-frame labels are checked like fixed-width ones, dropped
+        // and out of range labels are flagged instead of reaching an assert
+        else if (tc.size() > VTM_TCSTRING_FIXED_SIZE && is_dropframe) {
+            if (internal::parse_tcstring_wide(tc, fields) && valid_dropframe_fields(fields, nominal)) {
+                out[i] = F(fields_to_dropframe(fields, nominal)) / fps / F(100.0);
+            }
+            else reject(i);
+        }
+
+        // Wider hour fields, checked the same way and summed like fixed-width ones
+        else if (tc.size() > VTM_TCSTRING_FIXED_SIZE) {
+            if (internal::parse_tcstring_wide(tc, fields)) out[i] = fields_to_ticks(fields, coefs);
+            else reject(i);
+        }
+
+        else {
+            reject(i);
+        }
+    };
+
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    for (; !is_dropframe && i + 2 <= in.size(); i += 2) {
+        if (in[i].size() != VTM_TCSTRING_FIXED_SIZE || in[i + 1].size() != VTM_TCSTRING_FIXED_SIZE) {
+            parse_one(i);
+            parse_one(i + 1);
+            continue;
+        }
+
+        tcstring_fields f0, f1;
+        const unsigned valid = internal::parse_tcstring_fixed_avx2(in[i].data(), in[i + 1].data(), f0, f1);
+
+        if (valid & 0b01) out[i] = fields_to_ticks(f0, coefs);
+        else reject(i);
+
+        if (valid & 0b10) out[i + 1] = fields_to_ticks(f1, coefs);
+        else reject(i + 1);
+    }
+#endif
+
+    for (; i < in.size(); ++i) parse_one(i);
+
+    return invalid_count;
+}
+
+template<std::floating_point F>
+inline auto parse_timecodes(std::span<const std::string_view> in,
+                            const F fps,
+                            std::span<F> out,
+                            std::span<std::uint64_t> invalid = {}) -> std::size_t
+{
+    return parse_timecodes(in, fps, false, out, invalid);
+}
+
+// @SECTION: Formats in[i] to out + 11 * i, no separators or terminators.
+// Negative and non-finite entries are written as "00:00:00:00" and flagged in
+// `invalid`. Returns the number of invalid entries
+template<std::floating_point F>
+inline auto format_timecodes(std::span<const F> in,
+                             const F fps,
+                             const bool is_dropframe,
+                             char* out,
+                             std::span<std::uint64_t> invalid = {}) -> std::size_t
+{
+    VTM_ASSERT(fps > 0.0, "frame rate must be a non-zero floating point value");
+    VTM_ASSERT(invalid.empty() || invalid.size() >= tcbitmap_words(in.size()), "invalid entry bitmap is too small");
+
+    std::size_t invalid_count = 0;
+
+    for (auto& word : invalid.first(invalid.empty() ? 0 : tcbitmap_words(in.size()))) word = 0;
+
+    const auto fields_at = [&](std::size_t i) -> tcstring_fields {
+        const F n = in[i];
+        if (std::isfinite(n) && n >= 0.0) return ticks_to_fields(n, fps, is_dropframe);
+
+        internal::tcbitmap_set(invalid, i);
+        ++invalid_count;
+        return tcstring_fields{ 0, 0, 0, 0, is_dropframe };
+    };
+
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    // The kernel's 16-byte stores spill past the fourth timecode, keep one entry in reserve.
+    // Drop-frame labels need the integer frame count, those take the scalar path
+    for (; !is_dropframe && i + 5 <= in.size(); i += 4) {
+        std::array<tcstring_fields, 4> fields;
+        const unsigned rejected = internal::ticks_to_fields_avx2(in.data() + i, double(fps), is_dropframe, fields.data());
+
+        for (unsigned lane = 0; lane < 4; ++lane) {
+            if (!((rejected >> lane) & 1)) continue;
+            internal::tcbitmap_set(invalid, i + lane);
+            ++invalid_count;
+        }
+
+        internal::format_tcstring_fixed_avx2(out + i * VTM_TCSTRING_FIXED_SIZE, fields.data());
+    }
+#endif
+
+    for (; i < in.size(); ++i) format_tcstring_fixed(out + i * VTM_TCSTRING_FIXED_SIZE, fields_at(i));
+
+    return invalid_count;
+}
+
+// @SECTION: Formats drop-frame labels for in[i] frames to out + 11 * i, no
+// separators or terminators. Nominal is 30 for 29.97 and 60 for 59.94
+inline auto format_dropframe(std::span<const std::uint64_t> in,
+                             char* out,
+                             const std::uint64_t nominal = 30) -> void
+{
+    const auto format_all = [&]<std::uint64_t N>() {
+        for (std::size_t i = 0; i < in.size(); ++i) {
+            format_tcstring_fixed(out + i * VTM_TCSTRING_FIXED_SIZE, internal::dropframe_to_fields_n<N>(in[i]));
+        }
+    };
+
+    if (nominal == 30) return format_all.template operator()<30>();
+    if (nominal == 60) return format_all.template operator()<60>();
+
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        format_tcstring_fixed(out + i * VTM_TCSTRING_FIXED_SIZE, dropframe_to_fields(in[i], nominal));
+    }
+}
+
+// @SECTION: Parses drop-frame labels in[i] into out[i] frame counts. Malformed
+// strings and skipped frame numbers are written as zero and flagged in `invalid`.
+// Returns the number of invalid entries
+inline auto parse_dropframe(std::span<const std::string_view> in,
+                            std::span<std::uint64_t> out,
+                            std::span<std::uint64_t> invalid = {},
+                            const std::uint64_t nominal = 30) -> std::size_t
+{
+    VTM_ASSERT(out.size() >= in.size(), "output span is smaller than input span");
+    VTM_ASSERT(invalid.empty() || invalid.size() >= tcbitmap_words(in.size()), "invalid entry bitmap is too small");
+
+    std::size_t invalid_count = 0;
+
+    for (auto& word : invalid.first(invalid.empty() ? 0 : tcbitmap_words(in.size()))) word = 0;
+
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        tcstring_fields fields;
+        if (parse_tcstring_fixed(in[i], fields) && valid_dropframe_fields(fields, nominal)) {
+            out[i] = fields_to_dropframe(fields, nominal);
+            continue;
+        }
+
+        out[i] = 0;
+        internal::tcbitmap_set(invalid, i);
+        ++invalid_count;
+    }
+
+    return invalid_count;
+}
+
+} // @END OF namespace vtm::chrono
+
+///////////////////////////////////////////////////////////////////////////
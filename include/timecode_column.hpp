@@ -0,0 +1,425 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Columnar timecode storage with vectorized arithmetic kernels
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Project headers
+#include "errors.hpp"
+#include "timecode_batch.hpp"
+#include "timecode_common.hpp"
+#include "timecode_string.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Column Kernels --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono::internal {
+
+// @SECTION: v[i] = clamp(v[i] * a + b, lo, hi). Offsets pass a = 1, scales pass
+// b = 0, so both round once and the scalar and vector paths agree bit for bit
+template<std::floating_point T>
+inline auto column_affine_clamp(std::span<T> v, const T a, const T b, const T lo, const T hi) noexcept -> void
+{
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    if constexpr (std::is_same_v<T, double>) {
+        const __m256d va = _mm256_set1_pd(a);
+        const __m256d vb = _mm256_set1_pd(b);
+        const __m256d vlo = _mm256_set1_pd(lo);
+        const __m256d vhi = _mm256_set1_pd(hi);
+
+        for (; i + 4 <= v.size(); i += 4) {
+            const __m256d n = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(v.data() + i), va), vb);
+            _mm256_storeu_pd(v.data() + i, _mm256_min_pd(_mm256_max_pd(n, vlo), vhi));
+        }
+    }
+#endif
+
+    for (; i < v.size(); ++i) v[i] = std::min(std::max(v[i] * a + b, lo), hi);
+}
+
+// @SECTION: Smallest and largest value of a non-empty column
+template<std::floating_point T>
+inline auto column_minmax(std::span<const T> v) noexcept -> std::pair<T, T>
+{
+    T lo = v[0];
+    T hi = v[0];
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    if constexpr (std::is_same_v<T, double>) {
+        if (v.size() >= 4) {
+            __m256d vlo = _mm256_loadu_pd(v.data());
+            __m256d vhi = vlo;
+
+            for (i = 4; i + 4 <= v.size(); i += 4) {
+                const __m256d n = _mm256_loadu_pd(v.data() + i);
+                vlo = _mm256_min_pd(vlo, n);
+                vhi = _mm256_max_pd(vhi, n);
+            }
+
+            alignas(32) double los[4], his[4];
+            _mm256_store_pd(los, vlo);
+            _mm256_store_pd(his, vhi);
+            lo = std::min({ los[0], los[1], los[2], los[3] });
+            hi = std::max({ his[0], his[1], his[2], his[3] });
+        }
+    }
+#endif
+
+    for (; i < v.size(); ++i) {
+        lo = std::min(lo, v[i]);
+        hi = std::max(hi, v[i]);
+    }
+
+    return { lo, hi };
+}
+
+// @SECTION: out[i] = a[i] - b[i], signed ticks
+template<std::floating_point T>
+inline auto column_diff(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept -> void
+{
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    if constexpr (std::is_same_v<T, double>) {
+        for (; i + 4 <= a.size(); i += 4) {
+            _mm256_storeu_pd(out.data() + i, _mm256_sub_pd(_mm256_loadu_pd(a.data() + i), _mm256_loadu_pd(b.data() + i)));
+        }
+    }
+#endif
+
+    for (; i < a.size(); ++i) out[i] = a[i] - b[i];
+}
+
+// @SECTION: out[i] = -1, 0 or 1 as a[i] is less than, equal to or greater than
+// the right hand side. Rhs is either a column or a single broadcast value
+template<std::floating_point T, bool Broadcast>
+inline auto column_compare(std::span<const T> a, const T* b, std::span<std::int8_t> out) noexcept -> void
+{
+    const auto rhs_at = [&](std::size_t i) -> T { return Broadcast ? b[0] : b[i]; };
+
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    if constexpr (std::is_same_v<T, double>) {
+        for (; i + 4 <= a.size(); i += 4) {
+            const __m256d lhs = _mm256_loadu_pd(a.data() + i);
+            const __m256d rhs = Broadcast ? _mm256_set1_pd(b[0]) : _mm256_loadu_pd(b + i);
+            const unsigned gt = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ)));
+            const unsigned lt = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)));
+
+            for (unsigned lane = 0; lane < 4; ++lane) {
+                out[i + lane] = static_cast<std::int8_t>(int((gt >> lane) & 1) - int((lt >> lane) & 1));
+            }
+        }
+    }
+#endif
+
+    for (; i < a.size(); ++i) out[i] = static_cast<std::int8_t>(int(a[i] > rhs_at(i)) - int(a[i] < rhs_at(i)));
+}
+
+// @SECTION: Sum of a column. The vector path keeps four partial sums, so the
+// result can differ from a sequential sum in the last bits
+template<std::floating_point T>
+inline auto column_sum(std::span<const T> v) noexcept -> T
+{
+    T sum = 0;
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    if constexpr (std::is_same_v<T, double>) {
+        __m256d acc = _mm256_setzero_pd();
+        for (; i + 4 <= v.size(); i += 4) acc = _mm256_add_pd(acc, _mm256_loadu_pd(v.data() + i));
+
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, acc);
+        sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+#endif
+
+    for (; i < v.size(); ++i) sum += v[i];
+    return sum;
+}
+
+// @SECTION: Appends every i whose interval [a[i], b[i]) overlaps [lo, hi), in
+// ascending order
+template<std::floating_point T>
+inline auto column_overlaps(std::span<const T> a, std::span<const T> b, const T lo, const T hi, std::vector<std::size_t>& out) -> void
+{
+    std::size_t i = 0;
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+    if constexpr (std::is_same_v<T, double>) {
+        const __m256d vlo = _mm256_set1_pd(lo);
+        const __m256d vhi = _mm256_set1_pd(hi);
+
+        for (; i + 4 <= a.size(); i += 4) {
+            const __m256d starts = _mm256_cmp_pd(_mm256_loadu_pd(a.data() + i), vhi, _CMP_LT_OQ);
+            const __m256d ends = _mm256_cmp_pd(_mm256_loadu_pd(b.data() + i), vlo, _CMP_GT_OQ);
+            for (unsigned mask = static_cast<unsigned>(_mm256_movemask_pd(_mm256_and_pd(starts, ends))); mask != 0; mask &= mask - 1) {
+                out.push_back(i + std::size_t(std::countr_zero(mask)));
+            }
+        }
+    }
+#endif
+
+    for (; i < a.size(); ++i) {
+        if (a[i] < hi && b[i] > lo) out.push_back(i);
+    }
+}
+
+} // @END OF namespace vtm::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __BasicTimecodeColumn --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono::internal {
+
+// Structure of arrays over timecodes sharing one frame rate. Values are ticks
+// stored contiguously, at most 8 bytes wide so the kernels can fill vector lanes.
+// Element access converts to and from TTimecode
+template<typename TTimecode>
+class __BasicTimecodeColumn
+{
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Type Aliases --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    using value_type    = TTimecode;
+    using float_type    = typename TTimecode::float_type;
+    using storage_type  = std::conditional_t<(sizeof(float_type) > 8), double, float_type>;
+    using fps_factory_t = typename TTimecode::fps_factory_t;
+    using fps_t         = typename TTimecode::fps_t;
+    using size_type     = std::size_t;
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Ctors, Dtors & Assignment --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    explicit __BasicTimecodeColumn(const fps_t fps = fps_factory_t::default_value())
+        : _fps(fps)
+    {}
+
+    // Copies the ticks of each timecode, labels are then read at the column's rate
+    __BasicTimecodeColumn(std::span<const value_type> tcs, const fps_t fps)
+        : _values(tcs.size())
+        , _fps(fps)
+    {
+        for (size_type i = 0; i < tcs.size(); ++i) this->_values[i] = static_cast<storage_type>(tcs[i].as_float());
+    }
+
+    template<std::floating_point F>
+    __BasicTimecodeColumn(std::span<const F> ticks, const fps_t fps)
+        : _values(ticks.begin(), ticks.end())
+        , _fps(fps)
+    {}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Accessors & Mutators --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    auto fps() const noexcept -> fps_t { return this->_fps; }
+    auto set_fps(const fps_t fps) noexcept -> void { this->_fps = fps; }
+
+    auto size() const noexcept -> size_type { return this->_values.size(); }
+    auto empty() const noexcept -> bool { return this->_values.empty(); }
+    auto reserve(const size_type n) -> void { this->_values.reserve(n); }
+    auto resize(const size_type n) -> void { this->_values.resize(n); }
+    auto clear() noexcept -> void { this->_values.clear(); }
+
+    auto values() noexcept -> std::span<storage_type> { return this->_values; }
+    auto values() const noexcept -> std::span<const storage_type> { return this->_values; }
+
+    auto operator[](const size_type i) const -> value_type
+    {
+        return value_type{ float_type(this->_values[i]), this->_fps };
+    }
+
+    auto at(const size_type i) const -> value_type
+    {
+        VTM_ASSERT(i < this->size(), "timecode column index out of range");
+        return (*this)[i];
+    }
+
+    auto set(const size_type i, const value_type& tc) -> void
+    {
+        VTM_ASSERT(i < this->size(), "timecode column index out of range");
+        this->_values[i] = static_cast<storage_type>(tc.as_float());
+    }
+
+    auto push_back(const value_type& tc) -> void
+    {
+        this->_values.push_back(static_cast<storage_type>(tc.as_float()));
+    }
+
+    template<std::floating_point F>
+    auto push_back(const F ticks) -> void
+    {
+        this->_values.push_back(static_cast<storage_type>(ticks));
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Vectorized Arithmetic --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Shifts every value by `ticks`, which may be negative. Results are clamped
+    // to [0, max] like __BasicTimecodeFloat::operator+ and operator-
+    template<std::floating_point F>
+    auto offset(const F ticks) noexcept -> __BasicTimecodeColumn&
+    {
+        column_affine_clamp(this->values(), storage_type(1.0), storage_type(ticks), storage_type(0.0), std::numeric_limits<storage_type>::max());
+        return *this;
+    }
+
+    auto offset(const value_type& tc) noexcept -> __BasicTimecodeColumn&
+    {
+        return this->offset(tc.as_float());
+    }
+
+    // Multiplies every value by `factor`, e.g. 1001.0 / 1000.0 for a pull-down
+    template<std::floating_point F>
+    auto scale(const F factor) noexcept -> __BasicTimecodeColumn&
+    {
+        VTM_ASSERT(factor >= 0.0, "timecode column scale factor must be greater than or equal to zero");
+        column_affine_clamp(this->values(), storage_type(factor), storage_type(0.0), storage_type(0.0), std::numeric_limits<storage_type>::max());
+        return *this;
+    }
+
+    template<std::floating_point F>
+    auto clamp(const F lo, const F hi) noexcept -> __BasicTimecodeColumn&
+    {
+        VTM_ASSERT(lo <= hi, "timecode column clamp bounds are out of order");
+        column_affine_clamp(this->values(), storage_type(1.0), storage_type(0.0), storage_type(lo), storage_type(hi));
+        return *this;
+    }
+
+    auto clamp(const value_type& lo, const value_type& hi) noexcept -> __BasicTimecodeColumn&
+    {
+        return this->clamp(lo.as_float(), hi.as_float());
+    }
+
+    auto min() const -> value_type
+    {
+        VTM_ASSERT(!this->empty(), "min() called on an empty timecode column");
+        return value_type{ float_type(column_minmax(this->values()).first), this->_fps };
+    }
+
+    auto max() const -> value_type
+    {
+        VTM_ASSERT(!this->empty(), "max() called on an empty timecode column");
+        return value_type{ float_type(column_minmax(this->values()).second), this->_fps };
+    }
+
+    // out[i] = (*this)[i] - rhs[i] in signed ticks, `out` holds at least size() values
+    auto diff(const __BasicTimecodeColumn& rhs, std::span<storage_type> out) const -> void
+    {
+        VTM_ASSERT(rhs.size() == this->size(), "timecode columns differ in size");
+        VTM_ASSERT(rhs.fps() == this->fps(), "timecode columns differ in frame rate");
+        VTM_ASSERT(out.size() >= this->size(), "diff output span is too small");
+        column_diff(this->values(), rhs.values(), out);
+    }
+
+    // out[i] = -1, 0 or 1 as (*this)[i] orders before, with or after rhs[i]
+    auto compare(const __BasicTimecodeColumn& rhs, std::span<std::int8_t> out) const -> void
+    {
+        VTM_ASSERT(rhs.size() == this->size(), "timecode columns differ in size");
+        VTM_ASSERT(rhs.fps() == this->fps(), "timecode columns differ in frame rate");
+        VTM_ASSERT(out.size() >= this->size(), "compare output span is too small");
+        column_compare<storage_type, false>(this->values(), rhs.values().data(), out);
+    }
+
+    auto compare(const value_type& rhs, std::span<std::int8_t> out) const -> void
+    {
+        VTM_ASSERT(out.size() >= this->size(), "compare output span is too small");
+        const storage_type value = static_cast<storage_type>(rhs.as_float());
+        column_compare<storage_type, true>(this->values(), &value, out);
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Conversion Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Writes size() fixed-width labels to out + 11 * i, see format_timecodes()
+    auto format_to(char* out, std::span<std::uint64_t> invalid = {}) const -> std::size_t
+    {
+        return format_timecodes(this->values(),
+                                static_cast<storage_type>(fps_factory_t::to_float(this->_fps)),
+                                fps_factory_t::is_drop_frame(this->_fps),
+                                out,
+                                invalid);
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Private Data Members --
+//
+///////////////////////////////////////////////////////////////////////////
+
+private:
+    std::vector<storage_type> _values;
+    fps_t _fps;
+};
+
+} // @END OF namespace vtm::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
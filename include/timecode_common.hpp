@@ -8,7 +8,9 @@
 ///////////////////////////////////////////////////////////////////////////
 
 // Standard headers
+#include <array>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -27,68 +29,20 @@
 #define VTM_TIMECODE_FPS_DEFAULT 25
 #endif
 
-#define __FPS_TYPE() vtm::chrono::internal::__FPSFormat<vtm::chrono::float64_t, vtm::chrono::int64_t>::type
-
-// TODO: These aren't guaranteed to return the value you expect. It may short-circuit on duplicate values
-#define __FPSFORMAT_VALUE_TO_STRING(in) GET_ENUM_MAPPING_1(__FPSFORMAT_STRING(), in)
-#define __FPSFORMAT_STRING_TO_VALUE(in) GET_ENUM_MAPPING_2(__FPSFORMAT_STRING(), in)
-#define __FPSFORMAT_STRING() DECLARE_ENUM_MAPPING(__FPS_TYPE(),                            \
-                                                  std::string_view,                        \
-                                                  [](){ VTM_WARN("unknown fps format"); }, \
-                                                  [](){ VTM_WARN("unknown fps format"); }, \
-                                                  __FPS_TYPE()::none,                      \
-                                                  "NONE",                                  \
-                                                  "24 fps",                                \
-                                                  "25 fps",                                \
-                                                  "30 fps",                                \
-                                                  "29.97 fps",                             \
-                                                  "29.97 fps drop-frame",                  \
-                                                  "60 fps")
-
-#define __FPSFORMAT_VALUE_TO_INT(in) GET_ENUM_MAPPING_1(__FPSFORMAT_INT(), in)
-#define __FPSFORMAT_INT_TO_VALUE(in) GET_ENUM_MAPPING_2(__FPSFORMAT_INT(), in)
-#define __FPSFORMAT_INT() DECLARE_ENUM_MAPPING(__FPS_TYPE(),                            \
-                                               vtm::chrono::int64_t,                    \
-                                               [](){ VTM_WARN("unknown fps format"); }, \
-                                               [](){ VTM_WARN("unknown fps format"); }, \
-                                               __FPS_TYPE()::none,                      \
-                                               0,                                       \
-                                               24,                                      \
-                                               25,                                      \
-                                               30,                                      \
-                                               29,                                      \
-                                               -29,                                     \
-                                               60)
-
-#define __FPSFORMAT_VALUE_TO_FLOAT(in) GET_ENUM_MAPPING_1(__FPSFORMAT_FLOAT(), in)
-#define __FPSFORMAT_FLOAT_TO_VALUE(in) GET_ENUM_MAPPING_2(__FPSFORMAT_FLOAT(), in)
-#define __FPSFORMAT_FLOAT() DECLARE_ENUM_MAPPING(__FPS_TYPE(),                            \
-                                                 vtm::chrono::float64_t,                  \
-                                                 [](){ VTM_WARN("unknown fps format"); }, \
-                                                 [](){ VTM_WARN("unknown fps format"); }, \
-                                                 __FPS_TYPE()::none,                      \
-                                                 0.0,                                     \
-                                                 24.0,                                    \
-                                                 25.0,                                    \
-                                                 30.0,                                    \
-                                                 29.97,                                   \
-                                                 -29.97,                                  \
-                                                 60.0)
-
-#define __FPSFORMAT_VALUE_TO_DROPFRAME(in) GET_ENUM_MAPPING_1(__FPSFORMAT_DROPFRAME(), in)
-#define __FPSFORMAT_DROPFRAME_TO_VALUE(in) GET_ENUM_MAPPING_2(__FPSFORMAT_DROPFRAME(), in)
-#define __FPSFORMAT_DROPFRAME() DECLARE_ENUM_MAPPING(__FPS_TYPE(),                         \
-                                                  bool,                                    \
-                                                  [](){ VTM_WARN("unknown fps format"); }, \
-                                                  [](){ VTM_WARN("unknown fps format"); }, \
-                                                  __FPS_TYPE()::none,                      \
-                                                  false,                                   \
-                                                  false,                                   \
-                                                  false,                                   \
-                                                  false,                                   \
-                                                  false,                                   \
-                                                  true,                                    \
-                                                  false)
+#define __FPS_FORMAT() vtm::chrono::internal::__FPSFormat<vtm::chrono::float64_t, vtm::chrono::int64_t>
+#define __FPS_TYPE() __FPS_FORMAT()::type
+
+// Mapping macros, thin wrappers over the __FPSFormat rate registry
+#define __FPSFORMAT_VALUE_TO_STRING(in) __FPS_FORMAT()::to_string(in)
+#define __FPSFORMAT_STRING_TO_VALUE(in) __FPS_FORMAT()::from_string(in)
+#define __FPSFORMAT_VALUE_TO_INT(in) __FPS_FORMAT()::rate_info(in).int_value
+#define __FPSFORMAT_INT_TO_VALUE(in) __FPS_FORMAT()::from_int(in)
+#define __FPSFORMAT_VALUE_TO_FLOAT(in) __FPS_FORMAT()::rate_info(in).float_value
+#define __FPSFORMAT_FLOAT_TO_VALUE(in) __FPS_FORMAT()::from_float(in)
+#define __FPSFORMAT_VALUE_TO_DROPFRAME(in) __FPS_FORMAT()::is_drop_frame(in)
+#define __FPSFORMAT_DROPFRAME_TO_VALUE(in) __FPS_FORMAT()::from_drop_frame(in)
+#define __FPSFORMAT_VALUE_TO_NUMERATOR(in) __FPS_FORMAT()::to_rational(in).num
+#define __FPSFORMAT_VALUE_TO_DENOMINATOR(in) __FPS_FORMAT()::to_rational(in).den
 
 #endif // @END OF VTM_TIMECODE_CFG_MACROS
 
@@ -135,6 +89,22 @@ namespace vtm::chrono::internal {
 template<typename T>
 concept TimecodePrimitive = std::floating_point<T> || std::integral<T>;
 
+// @SECTION: Exact frame rate as frames per second = num / den
+template<std::integral TInt>
+struct __FPSRational
+{
+    TInt num = 0;
+    TInt den = 1;
+
+    // Frames counted per timecode label second, e.g. 30 for 30000/1001
+    constexpr auto nominal() const noexcept -> TInt
+    {
+        return (num + den - 1) / den;
+    }
+
+    constexpr bool operator==(const __FPSRational&) const = default;
+};
+
 // @SECTION: Default FPS Format Template
 template<typename T>
 concept FpsFormatFactory = std::is_enum_v<typename T::format>
@@ -151,7 +121,46 @@ concept FpsFormatFactory = std::is_enum_v<typename T::format>
                                { T::to_string(type) } -> vtm::traits::StringLike;
                            };
 
-// TODO: Constraint for Derived class
+// @SECTION: Constants for one frame rate, computed once at compile time
+template<std::floating_point TFloat, std::integral TInt>
+struct __FPSRateInfo
+{
+    __FPSRational<TInt> rational{};
+    bool drop_frame        = false;
+    std::string_view name  = "NONE";
+    TInt int_value         = 0;   // Integer code, negated for drop-frame
+    TFloat float_value     = 0.0; // Float code, negated for drop-frame
+    TFloat fps             = 0.0; // Frames per second of the tick model, e.g. 29.97
+    TInt nominal           = 0;   // Frames per timecode label second, e.g. 30
+    TFloat single_tick     = 0.0; // Ticks per frame, 1 / fps / 100
+};
+
+template<std::floating_point TFloat, std::integral TInt>
+constexpr auto make_fps_rate_info(const TInt num,
+                                  const TInt den,
+                                  const bool drop_frame,
+                                  const std::string_view name,
+                                  const double fps) -> __FPSRateInfo<TFloat, TInt>
+{
+    const __FPSRational<TInt> rational{ num, den };
+    const TInt sign = drop_frame ? -1 : 1;
+
+    return __FPSRateInfo<TFloat, TInt> {
+        rational,
+        drop_frame,
+        name,
+        sign * static_cast<TInt>(fps),
+        TFloat(sign) * TFloat(fps),
+        TFloat(fps),
+        rational.nominal(),
+        TFloat(1.0) / TFloat(fps) / TFloat(100.0)
+    };
+}
+
+// Rates are looked up by enumerator in a registry table, so every to_*() is an
+// index and every from_*() probes a hash table built from the same registry.
+// Fixed-width labels hold two frame digits, at 100 fps and above only frame,
+// tick and rational conversions are meaningful
 // TODO: Possible underflow for TInt
 template<std::floating_point TFloat, std::integral TInt>
 struct __FPSFormat
@@ -163,55 +172,141 @@ struct __FPSFormat
         fps_29p97,
         fpsdf_29p97,
         fps_60,
-        none
+        none,
+        fps_23p976,
+        fps_48,
+        fps_50,
+        fps_59p94,
+        fpsdf_59p94,
+        fps_100,
+        fps_119p88,
+        fps_120
     };
-    
+
     using __my_type = __FPSFormat<TFloat, TInt>;
     using type = format;
     using float_type = TFloat;
     using int_type = TInt;
+    using rate_info_type = __FPSRateInfo<TFloat, TInt>;
+
+    // Indexed by enumerator. Stored values predate the rates added after none,
+    // so none keeps its place and new rates go at the end
+    static constexpr std::array<rate_info_type, std::size_t(fps_120) + 1> rates {
+        make_fps_rate_info<TFloat, TInt>(24,     1,    false, "24 fps",               24.0),
+        make_fps_rate_info<TFloat, TInt>(25,     1,    false, "25 fps",               25.0),
+        make_fps_rate_info<TFloat, TInt>(30,     1,    false, "30 fps",               30.0),
+        make_fps_rate_info<TFloat, TInt>(30000,  1001, false, "29.97 fps",            29.97),
+        make_fps_rate_info<TFloat, TInt>(30000,  1001, true,  "29.97 fps drop-frame", 29.97),
+        make_fps_rate_info<TFloat, TInt>(60,     1,    false, "60 fps",               60.0),
+        rate_info_type{},
+        make_fps_rate_info<TFloat, TInt>(24000,  1001, false, "23.976 fps",           23.976),
+        make_fps_rate_info<TFloat, TInt>(48,     1,    false, "48 fps",               48.0),
+        make_fps_rate_info<TFloat, TInt>(50,     1,    false, "50 fps",               50.0),
+        make_fps_rate_info<TFloat, TInt>(60000,  1001, false, "59.94 fps",            59.94),
+        make_fps_rate_info<TFloat, TInt>(60000,  1001, true,  "59.94 fps drop-frame", 59.94),
+        make_fps_rate_info<TFloat, TInt>(100,    1,    false, "100 fps",              100.0),
+        make_fps_rate_info<TFloat, TInt>(120000, 1001, false, "119.88 fps",           119.88),
+        make_fps_rate_info<TFloat, TInt>(120,    1,    false, "120 fps",              120.0)
+    };
+
+    static_assert(rates.size() == magic_enum::enum_count<format>(), "every frame rate enumerator needs a registry entry");
+
+private:
+    // Every enumerator including none, so "NONE", 0 and 0.0 map back to none
+    // without a warning. Duplicate values keep their first enumerator
+    template<typename T>
+    static consteval auto rate_column(T rate_info_type::* member) -> std::array<T, rates.size()>
+    {
+        std::array<T, rates.size()> column{};
+        for (std::size_t i = 0; i < column.size(); ++i) column[i] = rates[i].*member;
+        return column;
+    }
+
+    static constexpr auto string_table = vtm::utility::internal::make_enum_mapping_table(magic_enum::enum_values<type>(), rate_column(&rate_info_type::name));
+    static constexpr auto int_table = vtm::utility::internal::make_enum_mapping_table(magic_enum::enum_values<type>(), rate_column(&rate_info_type::int_value));
+    static constexpr auto float_table = vtm::utility::internal::make_enum_mapping_table(magic_enum::enum_values<type>(), rate_column(&rate_info_type::float_value));
+    static constexpr auto dropframe_table = vtm::utility::internal::make_enum_mapping_table(magic_enum::enum_values<type>(), rate_column(&rate_info_type::drop_frame));
+
+    template<typename Table, typename V>
+    static constexpr auto lookup(const Table& table, const V& value) -> type
+    {
+        const std::size_t i = table.find(value);
+        if (i < table.values.size()) return table.options[i];
+        VTM_WARN("unknown fps format");
+        return none;
+    }
+
+public:
+    static constexpr auto rate_info(const type& t) -> const rate_info_type&
+    {
+        const auto i = static_cast<std::size_t>(t);
+        if (i < rates.size()) return rates[i];
+        VTM_WARN("unknown fps format");
+        return rates[std::size_t(none)];
+    }
 
     static constexpr auto default_value() -> type
     {
-        return __FPSFORMAT_INT_TO_VALUE(VTM_TIMECODE_FPS_DEFAULT);
+        return from_int(VTM_TIMECODE_FPS_DEFAULT);
     }
 
     static constexpr auto is_drop_frame(const type& t) -> bool
     {
-        return __FPSFORMAT_VALUE_TO_DROPFRAME(t);
+        return rate_info(t).drop_frame;
     }
 
     static constexpr auto from_int(std::integral auto const i) -> type
     {
-        return __FPSFORMAT_INT_TO_VALUE(i);
+        return lookup(int_table, static_cast<int_type>(i));
     }
 
     static constexpr auto from_float(std::floating_point auto const f) -> type
     {
-        return __FPSFORMAT_FLOAT_TO_VALUE(f);
+        return lookup(float_table, static_cast<float_type>(f));
     }
 
     static constexpr auto from_string(vtm::traits::StringLike auto const& s) -> type
     {
-        return __FPSFORMAT_STRING_TO_VALUE(s);
+        return lookup(string_table, std::string_view(s));
+    }
+
+    static constexpr auto from_drop_frame(const bool drop_frame) -> type
+    {
+        return lookup(dropframe_table, drop_frame);
     }
 
     static constexpr std::integral
     auto to_int(const type& t)
     {
-        return std::abs(__FPSFORMAT_VALUE_TO_INT(t));
+        const int_type i = rate_info(t).int_value;
+        return i < 0 ? -i : i;
     }
 
     static constexpr std::floating_point
     auto to_float(const type& t)
     {
-        return std::abs(__FPSFORMAT_VALUE_TO_FLOAT(t));
+        return rate_info(t).fps;
     }
 
     static constexpr vtm::traits::StringLike
     auto to_string(const type& t)
     {
-        return __FPSFORMAT_VALUE_TO_STRING(t);
+        return rate_info(t).name;
+    }
+
+    static constexpr auto to_rational(const type& t) -> __FPSRational<int_type>
+    {
+        return rate_info(t).rational;
+    }
+
+    static constexpr auto to_nominal(const type& t) -> int_type
+    {
+        return rate_info(t).nominal;
+    }
+
+    static constexpr auto to_single_tick(const type& t) -> float_type
+    {
+        return rate_info(t).single_tick;
     }
 };
 
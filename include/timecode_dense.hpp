@@ -0,0 +1,369 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Timecode library templates for dense value type implementation
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// Project headers
+#include "errors.hpp"
+#include "timecode_common.hpp"
+#include "timecode_float.hpp"
+#include "timecode_string.hpp"
+#include "traits.hpp"
+#include "utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono::internal {
+
+// @SECTION: Value types that can be moved around with memcpy and packed into SIMD lanes
+template<typename T>
+concept DenseTimecode = std::is_trivially_copyable_v<T>
+                     && std::is_standard_layout_v<T>
+                     && sizeof(T) <= 16;
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __BasicTimecodeDense --
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Same public interface as __BasicTimecodeFloat without the virtual interface
+// bases. Only the CRTP conversion mixins are inherited, which are empty, so a
+// value is its ticks plus a one byte frame rate. Ticks are stored in at most
+// 8 bytes, where long double is wider it is narrowed to double
+template<vtm::traits::StringLike TString,
+         vtm::traits::StringLike TView,
+         std::signed_integral TInt,
+         std::floating_point TFloat,
+         FpsFormatFactory TFps>
+class __BasicTimecodeDense : public vtm::traits::__convert_to_float<__BasicTimecodeDense<TString, TView, TInt, TFloat, TFps>, TFloat>
+                           , public vtm::traits::__convert_to_signed<__BasicTimecodeDense<TString, TView, TInt, TFloat, TFps>, TInt>
+                           , public vtm::traits::__convert_to_string<__BasicTimecodeDense<TString, TView, TInt, TFloat, TFps>, TString>
+{
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Type Aliases --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    using __my_type       = __BasicTimecodeDense<TString, TView, TInt, TFloat, TFps>;
+    using string_t        = std::remove_cvref_t<TString>;
+    using string_view_t   = std::remove_cvref_t<TView>;
+    using display_t       = string_view_t;
+    using signed_type     = typename vtm::traits::__convert_to_signed<__my_type, TInt>::signed_type;
+    using float_type      = typename vtm::traits::__convert_to_float<__my_type, TFloat>::float_type;
+    using string_type     = typename vtm::traits::__convert_to_string<__my_type, string_t>::string_type;
+    using storage_type    = std::conditional_t<(sizeof(float_type) > 8), double, float_type>;
+    using fps_factory_t   = TFps;
+    using fps_t           = typename TFps::type;
+    using __element1_type = storage_type;
+    using __element2_type = fps_t;
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Static Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    template<std::integral V>
+    static auto from_hmsf(const V h,
+                          const V m,
+                          const V s,
+                          const V f,
+                          const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeDense
+    {
+        VTM_ASSERT(h >= 0, "timecode hours must be greater than or equal to zero");
+        VTM_ASSERT(m >= 0, "timecode minutes must be greater than or equal zero");
+        VTM_ASSERT(s >= 0, "timecode seconds must be greater than or equal zero");
+        VTM_ASSERT(f >= 0, "timecode frames must be greater than or equal zero");
+
+        const float_type fps_float = fps_factory_t::to_float(fps);
+
+        if (fps_factory_t::is_drop_frame(fps)) {
+            const tcstring_fields fields{ std::uint32_t(h), std::uint32_t(m), std::uint32_t(s), std::uint32_t(f), true };
+            return __BasicTimecodeDense{ dropframe_fields_to_ticks(fields, fps_float), fps };
+        }
+
+        return __BasicTimecodeDense {
+            chunks_to_total_ticks(std::make_tuple(float_type(h), float_type(m), float_type(s), float_type(f)), fps_float),
+            fps
+        };
+    }
+
+    template<vtm::traits::StringConstructible S>
+    static auto from_string(const S& tc, const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeDense
+    {
+        return __BasicTimecodeDense {
+            tcstring_to_ticks(string_view_t(tc), fps_factory_t::to_float(fps), fps_factory_t::is_drop_frame(fps)),
+            fps
+        };
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Ctors, Dtors & Assignment --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Trivial copy and move, a moved-from value keeps its contents
+    __BasicTimecodeDense() = default;
+    ~__BasicTimecodeDense() = default;
+    __BasicTimecodeDense(const __BasicTimecodeDense&) = default;
+    __BasicTimecodeDense(__BasicTimecodeDense&&) noexcept = default;
+    __BasicTimecodeDense& operator=(const __BasicTimecodeDense&) = default;
+    __BasicTimecodeDense& operator=(__BasicTimecodeDense&&) noexcept = default;
+
+    template<TimecodePrimitive V>
+    explicit constexpr __BasicTimecodeDense(const V value, const fps_t fps = fps_factory_t::default_value()) noexcept
+        : _value(static_cast<storage_type>(value))
+        , _fps(static_cast<std::uint8_t>(fps))
+    {}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Accessors & Mutators --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    constexpr void reset() noexcept
+    {
+        this->_value = 0.0;
+    }
+
+    constexpr void set_value(const __BasicTimecodeDense& value) noexcept
+    {
+        this->_value = value._value;
+    }
+
+    template<TimecodePrimitive V>
+    constexpr void set_value(const V value) noexcept
+    {
+        this->_value = static_cast<storage_type>(value);
+    }
+
+    constexpr void set_fps(const fps_t fps) noexcept
+    {
+        this->_fps = static_cast<std::uint8_t>(fps);
+    }
+
+    constexpr auto fps() const noexcept -> fps_t
+    {
+        return static_cast<fps_t>(this->_fps);
+    }
+
+    auto is_drop_frame() const noexcept -> bool
+    {
+        return fps_factory_t::is_drop_frame(this->fps());
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// -- @SECTION Implicit Type Conversions --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    operator signed_type() const
+    {
+        return static_cast<signed_type>(std::round(this->_value));
+    }
+
+    constexpr operator float_type() const
+    {
+        return this->_value;
+    }
+
+    operator string_type() const
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        this->format_to(buffer);
+        return string_type(string_view_t(buffer, VTM_TCSTRING_FIXED_SIZE));
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Conversion Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Writes exactly 11 bytes to out, returns one past the last byte written
+    auto format_to(char* out) const -> char*
+    {
+        return vtm::chrono::format_to(out,
+                                      float_type(this->_value),
+                                      fps_factory_t::to_float(this->fps()),
+                                      fps_factory_t::is_drop_frame(this->fps()));
+    }
+
+    auto to_chars(char* first, char* last) const -> std::to_chars_result
+    {
+        return vtm::chrono::to_chars(first,
+                                     last,
+                                     float_type(this->_value),
+                                     fps_factory_t::to_float(this->fps()),
+                                     fps_factory_t::is_drop_frame(this->fps()));
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Arithmetic & Assigment Operations --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Primitive operands are raw ticks. Results are clamped to [0, max]
+    template<TimecodePrimitive V>
+    constexpr __BasicTimecodeDense& operator=(const V rhs) noexcept
+    {
+        this->set_value(rhs);
+        return *this;
+    }
+
+    constexpr __BasicTimecodeDense& operator+=(const __BasicTimecodeDense& rhs) noexcept
+    {
+        this->_value = std::min(std::numeric_limits<storage_type>::max(), this->_value + rhs._value);
+        return *this;
+    }
+
+    constexpr __BasicTimecodeDense& operator-=(const __BasicTimecodeDense& rhs) noexcept
+    {
+        this->_value = std::max(storage_type(0.0), this->_value - rhs._value);
+        return *this;
+    }
+
+    template<TimecodePrimitive V>
+    constexpr __BasicTimecodeDense& operator+=(const V rhs) noexcept
+    {
+        this->_value = std::clamp(this->_value + storage_type(rhs), storage_type(0.0), std::numeric_limits<storage_type>::max());
+        return *this;
+    }
+
+    template<TimecodePrimitive V>
+    constexpr __BasicTimecodeDense& operator-=(const V rhs) noexcept
+    {
+        this->_value = std::clamp(this->_value - storage_type(rhs), storage_type(0.0), std::numeric_limits<storage_type>::max());
+        return *this;
+    }
+
+    friend constexpr __BasicTimecodeDense operator+(__BasicTimecodeDense lhs, const __BasicTimecodeDense& rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+    friend constexpr __BasicTimecodeDense operator-(__BasicTimecodeDense lhs, const __BasicTimecodeDense& rhs) noexcept
+    {
+        return lhs -= rhs;
+    }
+
+    template<TimecodePrimitive V>
+    friend constexpr __BasicTimecodeDense operator+(__BasicTimecodeDense lhs, const V rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+    template<TimecodePrimitive V>
+    friend constexpr __BasicTimecodeDense operator-(__BasicTimecodeDense lhs, const V rhs) noexcept
+    {
+        return lhs -= rhs;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Equality Comparison --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    constexpr bool operator==(const __BasicTimecodeDense& rhs) const noexcept
+    {
+        return this->_value == rhs._value && this->_fps == rhs._fps;
+    }
+
+    constexpr auto operator<=>(const __BasicTimecodeDense& rhs) const noexcept -> std::partial_ordering
+    {
+        if (this->_fps != rhs._fps) return std::partial_ordering::unordered;
+        return this->_value <=> rhs._value;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Standard Library get() Overloads --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    template<std::size_t Index>
+    constexpr auto get() const noexcept
+    {
+        static_assert(Index < 2, "index out of bounds for __BasicTimecodeDense");
+        if constexpr (Index == 0) return this->_value;
+        if constexpr (Index == 1) return this->fps();
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Private Data Members --
+//
+///////////////////////////////////////////////////////////////////////////
+
+private:
+    storage_type _value = 0.0;
+    std::uint8_t _fps = static_cast<std::uint8_t>(fps_factory_t::default_value());
+};
+
+///////////////////////////////////////////////////////////////////////////
+
+} // @END OF namespace vtm::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
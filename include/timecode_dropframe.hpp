@@ -0,0 +1,111 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: SMPTE drop-frame label conversion
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <concepts>
+#include <cstdint>
+
+// Project headers
+#include "timecode_string.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Drop-Frame Label Conversion --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono::internal {
+
+// Drop-frame labels skip the first nominal / 15 frame numbers of every minute
+// (2 at 29.97, 4 at 59.94) except minutes divisible by ten. Nominal rates are
+// template parameters here so every division below is by a constant
+template<std::uint64_t Nominal>
+constexpr auto dropframe_to_fields_n(const std::uint64_t frames) noexcept -> tcstring_fields
+{
+    constexpr std::uint64_t drop = Nominal / 15;
+    constexpr std::uint64_t frames_per_minute = Nominal * 60 - drop;
+    constexpr std::uint64_t frames_per_10_minutes = Nominal * 600 - drop * 9;
+
+    const std::uint64_t tens = frames / frames_per_10_minutes;
+    const std::uint64_t rem = frames % frames_per_10_minutes;
+
+    // The first minute of each ten keeps all of its frame numbers
+    std::uint64_t label = frames + drop * 9 * tens;
+    if (rem >= drop) label += drop * ((rem - drop) / frames_per_minute);
+
+    return tcstring_fields {
+        static_cast<std::uint32_t>(label / (Nominal * 3600)),
+        static_cast<std::uint32_t>(label / (Nominal * 60) % 60),
+        static_cast<std::uint32_t>(label / Nominal % 60),
+        static_cast<std::uint32_t>(label % Nominal),
+        true
+    };
+}
+
+template<std::uint64_t Nominal>
+constexpr auto fields_to_dropframe_n(const tcstring_fields& fields) noexcept -> std::uint64_t
+{
+    constexpr std::uint64_t drop = Nominal / 15;
+
+    const std::uint64_t minutes = std::uint64_t(fields.hours) * 60 + fields.minutes;
+    const std::uint64_t label = (minutes * 60 + fields.seconds) * Nominal + fields.frames;
+    return label - drop * (minutes - minutes / 10);
+}
+
+} // @END OF namespace vtm::chrono::internal
+
+namespace vtm::chrono {
+
+// @SECTION: Frame count to drop-frame label fields, nominal is 30 for 29.97 and 60 for 59.94
+constexpr auto dropframe_to_fields(const std::uint64_t frames, const std::uint64_t nominal = 30) noexcept -> tcstring_fields
+{
+    if (nominal == 30) return internal::dropframe_to_fields_n<30>(frames);
+    if (nominal == 60) return internal::dropframe_to_fields_n<60>(frames);
+
+    const std::uint64_t drop = nominal / 15;
+    const std::uint64_t frames_per_minute = nominal * 60 - drop;
+    const std::uint64_t frames_per_10_minutes = nominal * 600 - drop * 9;
+    const std::uint64_t rem = frames % frames_per_10_minutes;
+
+    std::uint64_t label = frames + drop * 9 * (frames / frames_per_10_minutes);
+    if (rem >= drop) label += drop * ((rem - drop) / frames_per_minute);
+
+    return tcstring_fields {
+        static_cast<std::uint32_t>(label / (nominal * 3600)),
+        static_cast<std::uint32_t>(label / (nominal * 60) % 60),
+        static_cast<std::uint32_t>(label / nominal % 60),
+        static_cast<std::uint32_t>(label % nominal),
+        true
+    };
+}
+
+// @SECTION: Drop-frame label fields to frame count, fields must pass valid_dropframe_fields()
+constexpr auto fields_to_dropframe(const tcstring_fields& fields, const std::uint64_t nominal = 30) noexcept -> std::uint64_t
+{
+    if (nominal == 30) return internal::fields_to_dropframe_n<30>(fields);
+    if (nominal == 60) return internal::fields_to_dropframe_n<60>(fields);
+
+    const std::uint64_t minutes = std::uint64_t(fields.hours) * 60 + fields.minutes;
+    const std::uint64_t label = (minutes * 60 + fields.seconds) * nominal + fields.frames;
+    return label - (nominal / 15) * (minutes - minutes / 10);
+}
+
+// Rejects out of range fields and the frame numbers skipped at the top of each minute
+constexpr auto valid_dropframe_fields(const tcstring_fields& fields, const std::uint64_t nominal = 30) noexcept -> bool
+{
+    if (fields.minutes >= 60 || fields.seconds >= 60 || fields.frames >= nominal) return false;
+    return !(fields.seconds == 0 && fields.minutes % 10 != 0 && fields.frames < nominal / 15);
+}
+
+} // @END OF namespace vtm::chrono
+
+///////////////////////////////////////////////////////////////////////////
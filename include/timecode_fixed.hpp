@@ -0,0 +1,294 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Timecode library templates for compile-time frame rate implementation
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Project headers
+#include "errors.hpp"
+#include "timecode_common.hpp"
+#include "timecode_dropframe.hpp"
+#include "timecode_float.hpp"
+#include "timecode_string.hpp"
+#include "traits.hpp"
+#include "utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __BasicTimecodeFixed --
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Floating point ticks like __BasicTimecodeFloat, with the frame rate fixed at
+// compile time. Chunk coefficients and drop-frame constants are constexpr and
+// fold into the parse/format kernels, and values are bit-identical to a
+// __BasicTimecodeFloat at the same rate
+template<std::signed_integral TInt,
+         std::floating_point TFloat,
+         vtm::traits::StringLike TString,
+         vtm::traits::StringLike TView,
+         FpsFormatFactory TFps,
+         typename TFps::type Rate>
+class __BasicTimecodeFixed : public vtm::traits::__convert_to_float<__BasicTimecodeFixed<TInt, TFloat, TString, TView, TFps, Rate>, TFloat>
+                           , public vtm::traits::__convert_to_signed<__BasicTimecodeFixed<TInt, TFloat, TString, TView, TFps, Rate>, TInt>
+                           , public vtm::traits::__convert_to_string<__BasicTimecodeFixed<TInt, TFloat, TString, TView, TFps, Rate>, TString>
+{
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Type Aliases & Constants --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    using __my_type     = __BasicTimecodeFixed<TInt, TFloat, TString, TView, TFps, Rate>;
+    using string_t      = std::remove_cvref_t<TString>;
+    using string_view_t = std::remove_cvref_t<TView>;
+    using signed_type   = typename vtm::traits::__convert_to_signed<__my_type, TInt>::signed_type;
+    using float_type    = typename vtm::traits::__convert_to_float<__my_type, TFloat>::float_type;
+    using string_type   = typename vtm::traits::__convert_to_string<__my_type, string_t>::string_type;
+    using fps_factory_t = TFps;
+    using fps_t         = typename TFps::type;
+
+    static constexpr fps_t rate = Rate;
+    static constexpr float_type fps_float = fps_factory_t::to_float(Rate);
+    static constexpr bool drop_frame = fps_factory_t::is_drop_frame(Rate);
+    static constexpr std::uint64_t nominal = fps_factory_t::to_rational(Rate).nominal();
+    static constexpr std::array<float_type, 4> coefs = fps_to_ticks_by_chunk(fps_float);
+
+    static_assert(fps_float > 0.0, "fixed timecode frame rate must be a non-zero frame rate");
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Static Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    static constexpr auto fps() noexcept -> fps_t { return Rate; }
+
+    static constexpr auto is_drop_frame() noexcept -> bool { return drop_frame; }
+
+    static constexpr auto from_fields(const tcstring_fields& fields) -> __BasicTimecodeFixed
+    {
+        if constexpr (drop_frame) {
+            VTM_ASSERT(valid_dropframe_fields(fields, nominal) == true, "invalid drop-frame timecode");
+            return __BasicTimecodeFixed{ float_type(fields_to_dropframe_n<nominal>(fields)) / fps_float / float_type(100.0) };
+        }
+
+        else {
+            return __BasicTimecodeFixed{ fields_to_ticks(fields, coefs) };
+        }
+    }
+
+    template<std::integral V>
+    static auto from_hmsf(const V h, const V m, const V s, const V f) -> __BasicTimecodeFixed
+    {
+        VTM_ASSERT(h >= 0, "timecode hours must be greater than or equal to zero");
+        VTM_ASSERT(m >= 0, "timecode minutes must be greater than or equal zero");
+        VTM_ASSERT(s >= 0, "timecode seconds must be greater than or equal zero");
+        VTM_ASSERT(f >= 0, "timecode frames must be greater than or equal zero");
+
+        if constexpr (drop_frame) {
+            return from_fields(tcstring_fields{ std::uint32_t(h), std::uint32_t(m), std::uint32_t(s), std::uint32_t(f), true });
+        }
+
+        else {
+            return __BasicTimecodeFixed {
+                chunks_to_total_ticks(std::make_tuple(float_type(h), float_type(m), float_type(s), float_type(f)), fps_float)
+            };
+        }
+    }
+
+    template<vtm::traits::StringConstructible S>
+    static auto from_string(const S& tc) -> __BasicTimecodeFixed
+    {
+        const string_view_t view(tc);
+        tcstring_fields fields;
+
+        if (parse_tcstring_fixed(view, fields)) return from_fields(fields);
+
+        // Wider hour fields fall back to the general validating path
+        return __BasicTimecodeFixed{ tcstring_to_ticks(view, fps_float, drop_frame) };
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Ctors, Dtors & Assignment --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    __BasicTimecodeFixed() = default;
+    ~__BasicTimecodeFixed() = default;
+    __BasicTimecodeFixed(const __BasicTimecodeFixed&) = default;
+    __BasicTimecodeFixed(__BasicTimecodeFixed&&) noexcept = default;
+    __BasicTimecodeFixed& operator=(const __BasicTimecodeFixed&) = default;
+    __BasicTimecodeFixed& operator=(__BasicTimecodeFixed&&) noexcept = default;
+
+    template<TimecodePrimitive V>
+    explicit constexpr __BasicTimecodeFixed(const V value) noexcept
+        : _value(value)
+    {}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Accessors & Conversion Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    constexpr void set_value(const float_type value) noexcept
+    {
+        this->_value = value;
+    }
+
+    auto fields() const -> tcstring_fields
+    {
+        if constexpr (drop_frame) {
+            const float_type frames = std::max(float_type(0.0), this->_value * float_type(100.0) * fps_float) + float_type(0.5);
+            return dropframe_to_fields_n<nominal>(static_cast<std::uint64_t>(frames));
+        }
+
+        else {
+            return ticks_to_fields(this->_value, fps_float, false);
+        }
+    }
+
+    // Writes exactly 11 bytes to out, returns one past the last byte written
+    auto format_to(char* out) const -> char*
+    {
+        return format_tcstring_fixed(out, this->fields());
+    }
+
+    auto to_chars(char* first, char* last) const -> std::to_chars_result
+    {
+        return vtm::chrono::to_chars(first, last, this->fields());
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// -- @SECTION Implicit Type Conversions --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    operator signed_type() const
+    {
+        return static_cast<signed_type>(std::round(this->_value));
+    }
+
+    constexpr operator float_type() const
+    {
+        return this->_value;
+    }
+
+    operator string_type() const
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        this->format_to(buffer);
+        return string_type(string_view_t(buffer, VTM_TCSTRING_FIXED_SIZE));
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Arithmetic & Assigment Operations --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Operands share the frame rate by type, so nothing needs converting
+    constexpr __BasicTimecodeFixed& operator+=(const __BasicTimecodeFixed& rhs)
+    {
+        this->_value = std::min(std::numeric_limits<float_type>::max(), this->_value + rhs._value);
+        return *this;
+    }
+
+    constexpr __BasicTimecodeFixed& operator-=(const __BasicTimecodeFixed& rhs)
+    {
+        this->_value = std::max(float_type(0.0), this->_value - rhs._value);
+        return *this;
+    }
+
+    friend constexpr __BasicTimecodeFixed operator+(__BasicTimecodeFixed lhs, const __BasicTimecodeFixed& rhs)
+    {
+        return lhs += rhs;
+    }
+
+    friend constexpr __BasicTimecodeFixed operator-(__BasicTimecodeFixed lhs, const __BasicTimecodeFixed& rhs)
+    {
+        return lhs -= rhs;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Equality Comparison --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    constexpr bool operator==(const __BasicTimecodeFixed& rhs) const
+    {
+        return this->_value == rhs._value;
+    }
+
+    constexpr auto operator<=>(const __BasicTimecodeFixed& rhs) const -> std::partial_ordering
+    {
+        return this->_value <=> rhs._value;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Private Data Members --
+//
+///////////////////////////////////////////////////////////////////////////
+
+private:
+    float_type _value = 0.0;
+};
+
+///////////////////////////////////////////////////////////////////////////
+
+} // @END OF namespace vtm::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
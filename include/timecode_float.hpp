@@ -10,9 +10,11 @@
 // Standard headers
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <cmath>
 #include <compare>
 #include <concepts>
+#include <cstdint>
 #include <limits>
 #include <ranges>
 #include <string>
@@ -24,6 +26,8 @@
 // Project headers
 #include "errors.hpp"
 #include "timecode_common.hpp"
+#include "timecode_dropframe.hpp"
+#include "timecode_string.hpp"
 #include "traits.hpp"
 #include "utility.hpp"
 
@@ -74,13 +78,20 @@ inline auto get_tc_delimiter(bool is_dropframe) -> S
 }
 
 template<std::floating_point F>
-inline F tc_round(const F f)
+constexpr F tc_round(const F f)
 {
+    // std::round is not constexpr before C++23, round half away from zero by hand
+    if (std::is_constant_evaluated()) {
+        const F scaled = f * VTM_TIMECODE_FLOAT_ROUNDING_PRECISION;
+        const auto whole = static_cast<std::int64_t>(scaled < F(0.0) ? scaled - F(0.5) : scaled + F(0.5));
+        return F(whole) / VTM_TIMECODE_FLOAT_ROUNDING_PRECISION;
+    }
+
     return std::round(f * VTM_TIMECODE_FLOAT_ROUNDING_PRECISION) / VTM_TIMECODE_FLOAT_ROUNDING_PRECISION;
 }
 
 template<std::floating_point F>
-inline F fps_to_single_tick(const F fps)
+constexpr F fps_to_single_tick(const F fps)
 {
     VTM_ASSERT(fps > 0.0, "Frame rate must be a non-zero floating point value");
     return 1.0 / fps / 100.0;
@@ -97,7 +108,7 @@ inline auto chunks_to_total_ticks(const std::tuple<Args...>& time, const T fps)
 }
 
 template<std::floating_point T>
-inline auto fps_to_ticks_by_chunk(const T fps) -> std::array<T, 4>
+constexpr auto fps_to_ticks_by_chunk(const T fps) -> std::array<T, 4>
 {
     VTM_ASSERT(fps > 0.0, "frame rate must be a non-zero floating point value");
     using float_t = T;
@@ -109,36 +120,56 @@ inline auto fps_to_ticks_by_chunk(const T fps) -> std::array<T, 4>
     return std::array{ht, mt, st, ft};
 }
 
-template<vtm::traits::StringLike S, std::floating_point F>
-inline auto ticks_to_chunk_string(const F n, const F k, bool round = false) -> S
+template<std::floating_point F>
+inline auto ticks_to_fields(const F n, const F fps, bool is_dropframe = false) -> tcstring_fields
 {
+    VTM_ASSERT(fps > 0.0, "frame rate must be a non-zero floating point value");
+
     using float_t = F;
-    using string_t = S;
-    string_t str = "00";
-    float_t d = (round) ? std::round(n / k) : n / k;
 
-    if (d > n / k) return str;
-    str = std::to_string(d);
-    str = str.substr(0, str.find_first_of('.', 0));
+    // Drop-frame labels are a pure function of the frame count, the rate's
+    // nominal frames per label second selects the drop pattern
+    if (is_dropframe) {
+        const float_t frames = std::max(float_t(0.0), n * float_t(100.0) * fps) + float_t(0.5);
+        return dropframe_to_fields(static_cast<std::uint64_t>(frames), static_cast<std::uint64_t>(std::ceil(fps)));
+    }
+
+    // Whole seconds are rounded at half a frame so a frame that rounds up
+    // carries into the next second instead of wrapping back to frame zero
+    // Both operands are non-negative here, so truncation is floor
+    const float_t secs = std::max(float_t(0.0), n * float_t(100.0));
+    const float_t half_frame = float_t(0.5) / fps;
+    const auto total_secs = static_cast<std::uint64_t>(secs + half_frame);
+    const auto frames = static_cast<std::uint32_t>((secs - float_t(total_secs)) * fps + float_t(0.5));
+
+    return tcstring_fields {
+        static_cast<std::uint32_t>(total_secs / 3600),
+        static_cast<std::uint32_t>(total_secs / 60 % 60),
+        static_cast<std::uint32_t>(total_secs % 60),
+        frames,
+        is_dropframe
+    };
+}
+
+// @SECTION: Allocation-free formatting, writes exactly 11 bytes
+template<std::floating_point F>
+inline auto format_to(char* out, const F n, const F fps, bool is_dropframe = false) -> char*
+{
+    return format_tcstring_fixed(out, ticks_to_fields(n, fps, is_dropframe));
+}
 
-    return (str.length() == 1) ? ("0" + str) : str;
+template<std::floating_point F>
+inline auto to_chars(char* first, char* last, const F n, const F fps, bool is_dropframe = false) -> std::to_chars_result
+{
+    return to_chars(first, last, ticks_to_fields(n, fps, is_dropframe));
 }
 
 template<vtm::traits::StringLike S, std::floating_point F>
 auto ticks_to_string(F n, const F fps, bool is_dropframe = false) -> S
 {
-    VTM_ASSERT(fps > 0.0, "frame rate must be a non-zero floating point value");
-
-    using string_t = S;
-    using float_t = F;
-
-    const auto& [ht, mt, st, ft] = fps_to_ticks_by_chunk(fps);
-    string_t h = ticks_to_chunk_string<string_t>(n, ht); n = std::fmod(n, ht);
-    string_t m = ticks_to_chunk_string<string_t>(n, mt); n = std::fmod(n, mt);
-    string_t s = ticks_to_chunk_string<string_t>(n, st); n = std::fmod(n, st);
-    string_t f = ticks_to_chunk_string<string_t>(n, ft, true);
-
-    return h + ":" + m + ":" + s + get_tc_delimiter(is_dropframe) + f;
+    char buffer[VTM_TCSTRING_FIXED_SIZE];
+    format_to(buffer, n, fps, is_dropframe);
+    return S(std::string_view(buffer, VTM_TCSTRING_FIXED_SIZE));
 }
 
 template<vtm::traits::StringLike S>
@@ -148,18 +179,24 @@ inline auto valid_tcstring(const S& tc) -> bool
     bool valid = !rg::empty(tc);
     if (!valid) return false;
 
+    if (rg::size(tc) == VTM_TCSTRING_FIXED_SIZE) {
+        tcstring_fields fields;
+        return parse_tcstring_fixed(rg::data(tc), fields);
+    }
+
     std::size_t chunk_count = 0;
     std::array<std::size_t, 4> chunk_sizes{ 0, 2, 2, 2 };
     const auto delim = get_tc_delimiter(tc);
 
     for (const auto& ch : rg::split_view(tc, delim)) {
         const std::string_view sv(ch.begin(), ch.end());
+        if (chunk_count == chunk_sizes.size()) return false;
 
         if (chunk_sizes[chunk_count] > 0)
             valid = valid && sv.length() == chunk_sizes[chunk_count];
 
         for (const auto& d : sv) {
-            valid = valid && std::isdigit(d);
+            valid = valid && std::isdigit(static_cast<unsigned char>(d));
             if (!valid) return false;
         }
 
@@ -169,28 +206,102 @@ inline auto valid_tcstring(const S& tc) -> bool
     return valid && chunk_count == 4;
 }
 
+template<std::floating_point F>
+constexpr auto fields_to_ticks(const tcstring_fields& fields, const std::array<F, 4>& coefs) noexcept -> F
+{
+    // Chunks are summed in hours, minutes, seconds, frames order like the split_view path
+    F ticks = 0.0;
+    ticks += F(fields.hours) * coefs[0];
+    ticks += F(fields.minutes) * coefs[1];
+    ticks += F(fields.seconds) * coefs[2];
+    ticks += F(fields.frames) * coefs[3];
+    return ticks;
+}
+
+template<std::floating_point F>
+inline auto dropframe_fields_to_ticks(const tcstring_fields& fields, const F fps) -> F
+{
+    const auto nominal = static_cast<std::uint64_t>(std::ceil(fps));
+    VTM_ASSERT(valid_dropframe_fields(fields, nominal) == true, "invalid drop-frame timecode was parsed");
+    return F(fields_to_dropframe(fields, nominal)) / fps / F(100.0);
+}
+
 template<vtm::traits::StringLike S, std::floating_point F>
-inline auto tcstring_to_ticks(const S& tc, const F fps) -> F
+inline auto tcstring_to_ticks(const S& tc, const F fps, bool is_dropframe = false) -> F
 {
     namespace rg = std::ranges;
     using string_t = S;
     using float_t = F;
 
+    const auto coefs = fps_to_ticks_by_chunk(fps);
+    float_t ticks = 0.0;
+
+    // Fixed-width fast path, validates and converts in a single pass
+    if (rg::size(tc) == VTM_TCSTRING_FIXED_SIZE) {
+        tcstring_fields fields;
+        const bool valid = parse_tcstring_fixed(rg::data(tc), fields);
+        VTM_ASSERT(valid == true, "invalid timecode string was parsed");
+
+        if (is_dropframe) return dropframe_fields_to_ticks(fields, fps);
+        return fields_to_ticks(fields, coefs);
+    }
+
     VTM_ASSERT(valid_tcstring(tc) == true, "invalid timecode string was parsed");
 
     const auto delim = get_tc_delimiter(tc);
-    const auto coefs = fps_to_ticks_by_chunk(fps);
-    float_t ticks = 0.0;
 
     std::size_t i = 0;
+    std::array<std::uint32_t, 4> chunks{};
     for (const auto& ch : rg::split_view(tc, delim)) {
         const std::string_view chunk(ch.begin(), ch.end());
-        ticks += vtm::string_to_float<float_t>(chunk) * coefs[i++];
+        const float_t value = vtm::string_to_float<float_t>(chunk);
+        chunks[i] = static_cast<std::uint32_t>(value);
+        ticks += value * coefs[i++];
     }
-    
+
+    if (is_dropframe) {
+        return dropframe_fields_to_ticks(tcstring_fields{ chunks[0], chunks[1], chunks[2], chunks[3], true }, fps);
+    }
+
     return ticks;
 }
 
+// @SECTION: String literal usable as a template argument, e.g. from_string<"01:00:00:00">()
+template<std::size_t N>
+struct tcliteral
+{
+    char data[N]{};
+
+    consteval tcliteral(const char (&str)[N])
+    {
+        for (std::size_t i = 0; i < N; ++i) data[i] = str[i];
+    }
+
+    constexpr auto view() const noexcept -> std::string_view { return std::string_view(data, N - 1); }
+};
+
+// @SECTION: Compile-time tcstring_to_ticks(). Only the fixed "HH:MM:SS:FF" layout
+// is accepted and every field is range checked. A malformed literal is not a
+// constant expression, so it fails the build instead of asserting at runtime
+template<std::floating_point F>
+consteval auto tcliteral_to_ticks(const std::string_view tc, const F fps, const bool is_dropframe) -> F
+{
+    tcstring_fields fields;
+    if (!parse_tcstring_fixed(tc, fields)) throw "timecode literal must be in \"HH:MM:SS:FF\" form";
+
+    const auto nominal = static_cast<std::uint64_t>(fps) + (F(static_cast<std::uint64_t>(fps)) < fps ? 1 : 0);
+    if (fields.minutes >= 60 || fields.seconds >= 60) throw "timecode literal minutes and seconds must be below 60";
+    if (fields.frames >= nominal) throw "timecode literal frames must be below the frame rate";
+
+    if (is_dropframe) {
+        if (!valid_dropframe_fields(fields, nominal)) throw "timecode literal names a dropped frame";
+        return F(fields_to_dropframe(fields, nominal)) / fps / F(100.0);
+    }
+
+    if (fields.drop_frame) throw "drop-frame delimiter in a non-drop-frame timecode literal";
+    return fields_to_ticks(fields, fps_to_ticks_by_chunk(fps));
+}
+
 } // @END OF namespace vtm::chrono
 
 ///////////////////////////////////////////////////////////////////////////
@@ -339,6 +450,11 @@ public:
         VTM_ASSERT(s >= 0, "timecode seconds must be greater than or equal zero");
         VTM_ASSERT(f >= 0, "timecode frames must be greater than or equal zero");
 
+        if (fps_factory_t::is_drop_frame(fps)) {
+            const tcstring_fields fields{ std::uint32_t(h), std::uint32_t(m), std::uint32_t(s), std::uint32_t(f), true };
+            return __BasicTimecodeFloat { dropframe_fields_to_ticks(fields, fps_factory_t::to_float(fps)), fps };
+        }
+
         return __BasicTimecodeFloat {
             chunks_to_total_ticks(std::make_tuple(float_type(h), float_type(m), float_type(s), float_type(f)),
                                   __FPSFORMAT_VALUE_TO_FLOAT(fps)),
@@ -349,21 +465,27 @@ public:
     template<vtm::traits::StringConstructible S>
     static auto from_string(const S& tc, const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeFloat
     {
-        const char* msg = "cannot create new timecode object with invalid timecode string";
+        // tcstring_to_ticks() validates while parsing, no separate validation pass
+        const auto fps_float = fps_factory_t::to_float(fps);
+        const bool is_dropframe = fps_factory_t::is_drop_frame(fps);
 
         if constexpr (std::same_as<string_t, S> || std::same_as<string_view_t, S>){
-            VTM_ASSERT(valid_tcstring(tc), msg);
-            return __BasicTimecodeFloat { tcstring_to_ticks(tc, __FPSFORMAT_VALUE_TO_FLOAT(fps)),
-                                          fps };
+            return __BasicTimecodeFloat { tcstring_to_ticks(tc, fps_float, is_dropframe), fps };
         }
 
         else {
-            VTM_ASSERT(valid_tcstring(string_t(tc)), msg);
-            return __BasicTimecodeFloat { tcstring_to_ticks(string_t(tc), __FPSFORMAT_VALUE_TO_FLOAT(fps)), 
-                                          fps };
+            return __BasicTimecodeFloat { tcstring_to_ticks(string_view_t(tc), fps_float, is_dropframe), fps };
         }
     }
 
+    // Parsed and validated at compile time, only the resulting ticks are embedded
+    template<tcliteral Tc, fps_t Fps = fps_factory_t::default_value()>
+    static auto from_string() -> __BasicTimecodeFloat
+    {
+        constexpr float_type ticks = tcliteral_to_ticks(Tc.view(), fps_factory_t::to_float(Fps), fps_factory_t::is_drop_frame(Fps));
+        return __BasicTimecodeFloat { ticks, Fps };
+    }
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -497,9 +619,9 @@ public:
 
     operator string_type() const
     {
-        return ticks_to_string<string_t>(this->as_float(),
-                                         fps_factory_t::to_float(this->_fps),
-                                         fps_factory_t::is_drop_frame(this->_fps));
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        this->format_to(buffer);
+        return string_type(string_view_t(buffer, VTM_TCSTRING_FIXED_SIZE));
     }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -521,6 +643,24 @@ public:
                                             [this]() { return this->fps();       })();
     }
 
+    // Writes exactly 11 bytes to out, returns one past the last byte written
+    auto format_to(char* out) const -> char*
+    {
+        return vtm::chrono::format_to(out,
+                                      this->_value,
+                                      fps_factory_t::to_float(this->_fps),
+                                      fps_factory_t::is_drop_frame(this->_fps));
+    }
+
+    auto to_chars(char* first, char* last) const -> std::to_chars_result
+    {
+        return vtm::chrono::to_chars(first,
+                                     last,
+                                     this->_value,
+                                     fps_factory_t::to_float(this->_fps),
+                                     fps_factory_t::is_drop_frame(this->_fps));
+    }
+
     template<typename A = float_type, typename B = fps_t, typename C = string_t>
     auto as_tuple() const -> std::tuple<A, B, C>
     {
@@ -8,14 +8,20 @@
 ///////////////////////////////////////////////////////////////////////////
 
 // Standard headers
+#include <bit>
 #include <bitset>
+#include <compare>
 #include <concepts>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 // Library headers
 #include "errors.hpp"
 #include "timecode_common.hpp"
+#include "timecode_dropframe.hpp"
+#include "timecode_float.hpp"
+#include "timecode_string.hpp"
 #include "traits.hpp"
 #include "utility.hpp"
 
@@ -32,22 +38,120 @@
 
 namespace vtm::chrono::internal {
 
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Packed Digit Kernels --
+//
+///////////////////////////////////////////////////////////////////////////
+
+// One decimal digit per byte, least significant first:
+// byte 0 = frames units, 1 = frames tens, 2 = seconds units ... 7 = hours tens.
+// Reading the bytes high to low gives the "HHMMSSFF" label, and comparing two
+// packed values as integers compares the labels
+using tcdigits_t = std::uint64_t;
+
+inline constexpr tcdigits_t tcdigits_upper_mask = 0xFFFFFFFFFFFF0000ull;
+
+// Per lane (256 - radix) for seconds, minutes and hours: 10, 6, 10, 6, 10, 10.
+// Adding the bias first makes a lane that reaches its radix overflow into the
+// next lane through the ordinary 64-bit carry chain
+inline constexpr tcdigits_t tcdigits_upper_bias = 0xF6F6FAF6FAF60000ull;
+
+// Per lane (radix - 1), the mixed radix complement of the upper lanes
+inline constexpr tcdigits_t tcdigits_upper_max = 0x0909050905090000ull;
+
+constexpr auto tcdigits_bswap(const tcdigits_t v) noexcept -> tcdigits_t
+{
+    tcdigits_t r = 0;
+    for (unsigned i = 0; i < 8; ++i) r |= ((v >> (i * 8)) & 0xFF) << ((7 - i) * 8);
+    return r;
+}
+
+constexpr auto tcdigits_frames(const tcdigits_t d) noexcept -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(((d >> 8) & 0xFF) * 10 + (d & 0xFF));
+}
+
+constexpr auto tcdigits_with_frames(const tcdigits_t d, const std::uint32_t frames) noexcept -> tcdigits_t
+{
+    return (d & tcdigits_upper_mask) | (tcdigits_t(frames / 10) << 8) | tcdigits_t(frames % 10);
+}
+
+constexpr auto fields_to_tcdigits(const tcstring_fields& fields) noexcept -> tcdigits_t
+{
+    const auto pair = [](std::uint32_t v, unsigned lane) { return (tcdigits_t(v / 10 % 10) << ((lane + 1) * 8)) | (tcdigits_t(v % 10) << (lane * 8)); };
+    return pair(fields.hours, 6) | pair(fields.minutes, 4) | pair(fields.seconds, 2) | pair(fields.frames, 0);
+}
+
+constexpr auto tcdigits_to_fields(const tcdigits_t d, const bool drop_frame) noexcept -> tcstring_fields
+{
+    const auto pair = [d](unsigned lane) { return static_cast<std::uint32_t>(((d >> ((lane + 1) * 8)) & 0xFF) * 10 + ((d >> (lane * 8)) & 0xFF)); };
+    return tcstring_fields{ pair(6), pair(4), pair(2), pair(0), drop_frame };
+}
+
+// Upper lanes of a + b + carry_in (carry_in into seconds units). Carries out of
+// the hours tens lane are dropped, so hours wrap at 100
+constexpr auto tcdigits_add_upper(const tcdigits_t a, const tcdigits_t b, const tcdigits_t carry_in) noexcept -> tcdigits_t
+{
+    const tcdigits_t sum = (a & tcdigits_upper_mask) + tcdigits_upper_bias + (b & tcdigits_upper_mask) + (carry_in << 16);
+
+    // Lanes that did not wrap still hold their bias, which sets their high bit
+    const tcdigits_t unwrapped = (sum >> 7) & 0x0101010101010000ull;
+    return sum - ((unwrapped * 0xFF) & tcdigits_upper_bias);
+}
+
+// Reports whether a - b - borrow_in stays non-negative, writing the upper lanes of the difference
+constexpr auto tcdigits_sub_upper(const tcdigits_t a, const tcdigits_t b, const tcdigits_t borrow_in, tcdigits_t& out) noexcept -> bool
+{
+    // a - b - borrow == a + (max - b) + (1 - borrow) - 10^n, the dropped
+    // carry out of the hours tens lane is the 10^n
+    const tcdigits_t complement = tcdigits_upper_max - (b & tcdigits_upper_mask);
+    const tcdigits_t sum = (a & tcdigits_upper_mask) + tcdigits_upper_bias + complement + ((1 - borrow_in) << 16);
+    const tcdigits_t unwrapped = (sum >> 7) & 0x0101010101010000ull;
+
+    out = sum - ((unwrapped * 0xFF) & tcdigits_upper_bias);
+    return (unwrapped >> 56) == 0;
+}
+
+// Straight byte shuffle to "HH:MM:SS:FF", exactly 11 bytes
+inline auto format_tcdigits(char* out, const tcdigits_t d, const bool drop_frame) noexcept -> char*
+{
+    static_assert(std::endian::native == std::endian::little, "packed timecode digits require a little-endian target");
+
+    const tcdigits_t s = tcdigits_bswap(d) | 0x3030303030303030ull;
+    const tcdigits_t lo = (s & 0xFFFF) | ((s << 8) & 0xFFFF000000ull) | ((s << 16) & 0xFFFF000000000000ull) | 0x00003A00003A0000ull;
+    const std::uint32_t hi = std::uint32_t(drop_frame ? ';' : ':') | std::uint32_t((s >> 48) & 0xFFFF) << 8;
+
+    std::memcpy(out, &lo, 8);
+    std::memcpy(out + 8, &hi, 3);
+    return out + VTM_TCSTRING_FIXED_SIZE;
+}
+
+// Inverse shuffle, tc must already be a valid fixed-width timecode string
+inline auto parse_tcdigits(const char* tc) noexcept -> tcdigits_t
+{
+    static_assert(std::endian::native == std::endian::little, "packed timecode digits require a little-endian target");
+
+    tcdigits_t lo = 0;
+    std::uint32_t hi = 0;
+    std::memcpy(&lo, tc, 8);
+    std::memcpy(&hi, tc + 8, 3);
+
+    const tcdigits_t s = (lo & 0xFFFF) | ((lo >> 8) & 0xFFFF0000ull) | ((lo >> 16) & 0xFFFF00000000ull) | (tcdigits_t(hi >> 8) << 48);
+    return tcdigits_bswap(s - 0x3030303030303030ull);
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+
 ///////////////////////////////////////////////////////////////////////////
 //
 //  -- @SECTION __BasicTimecodeInt --
 //
 ///////////////////////////////////////////////////////////////////////////
 
-#define TCSTRING_GROUP_WIDTH 2
-#define TCSTRING_TOTAL_GROUPS 4
-#define TCSTRING_SIZE (TCSTRING_GROUP_WIDTH * TCSTRING_TOTAL_GROUPS)
-#define TCSTRING_COLON_DEFAULT ":"
-#define TCSTRING_COLON_DROPFRAME ";"
-#define TCSTRING_HRS_START 0
-#define TCSTRING_MINS_START (TCSTRING_GROUP_WIDTH * 1)
-#define TCSTRING_SECS_START (TCSTRING_GROUP_WIDTH * 2)
-#define TCSTRING_FRAMES_START (TCSTRING_GROUP_WIDTH * 3)
 #define TC_FLAGS_SIZE 8
+#define TC_FLAGS_DROPFRAME 0
 
 // TODO: concept & type trait to get unsigned and signed types
 template<std::integral TInt,
@@ -56,8 +160,8 @@ template<std::integral TInt,
          vtm::traits::StringLike TView,
          FpsFormatFactory TFps>
 class __BasicTimecodeInt : public vtm::traits::__reset
-                         , public vtm::traits::__implicit_string_overloads<TString, TView>
-                         , public vtm::traits::__display<typename vtm::traits::__implicit_string_overloads<TString, TView>::string_view_type>
+                         , public vtm::traits::__implicit_type_overload<TString>
+                         , public vtm::traits::__display<typename vtm::traits::__implicit_type_overload<TString>::type>
                          , public vtm::traits::__convert_to_signed<__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps>, TInt>
                          , public vtm::traits::__convert_to_float<__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps>, TFloat>
                          , public vtm::traits::__convert_to_string<__BasicTimecodeInt<TInt, TFloat, TString, TView, TFps>, TString>
@@ -71,13 +175,13 @@ class __BasicTimecodeInt : public vtm::traits::__reset
 
 public:
     using __my_type       = __BasicTimecodeInt<TInt, TFloat, TString, TView, TFps>;
-    using string_t        = typename vtm::traits::__implicit_string_overloads<TString, TView>::string_type;
-    using string_view_t   = typename vtm::traits::__implicit_string_overloads<TString, TView>::string_view_type;
+    using string_t        = typename vtm::traits::__implicit_type_overload<TString>::type;
+    using string_view_t   = std::remove_cvref_t<TView>;
     using signed_type     = typename vtm::traits::__convert_to_signed<__my_type, TInt>::signed_type;
     using float_type      = typename vtm::traits::__convert_to_float<__my_type, TFloat>::float_type;
     using string_type     = typename vtm::traits::__convert_to_string<__my_type, string_t>::string_type;
     using char_t          = vtm::traits::string_char_type_t<string_t>;
-    using display_t       = string_view_t;
+    using display_t       = string_t;
     using fps_factory_t   = TFps;
     using fps_t           = typename TFps::type;
     using __element1_type = float_t;
@@ -87,6 +191,83 @@ public:
 ///////////////////////////////////////////////////////////////////////////
 
 
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Static Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    static auto from_fields(const tcstring_fields& fields, const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeInt
+    {
+        const auto nominal = static_cast<std::uint32_t>(fps_factory_t::to_rational(fps).nominal());
+        VTM_ASSERT(nominal > 0, "frame rate must be a non-zero rational value");
+        VTM_ASSERT(fields.hours < 100 && fields.minutes < 60 && fields.seconds < 60 && fields.frames < nominal,
+                   "timecode fields are out of range for the frame rate");
+
+        if (fps_factory_t::is_drop_frame(fps)) {
+            VTM_ASSERT(valid_dropframe_fields(fields, nominal) == true, "invalid drop-frame timecode");
+        }
+
+        return from_digits(fields_to_tcdigits(fields), fps);
+    }
+
+    template<std::integral V>
+    static auto from_hmsf(const V h,
+                          const V m,
+                          const V s,
+                          const V f,
+                          const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeInt
+    {
+        VTM_ASSERT(h >= 0, "timecode hours must be greater than or equal to zero");
+        VTM_ASSERT(m >= 0, "timecode minutes must be greater than or equal zero");
+        VTM_ASSERT(s >= 0, "timecode seconds must be greater than or equal zero");
+        VTM_ASSERT(f >= 0, "timecode frames must be greater than or equal zero");
+
+        const bool drop_frame = fps_factory_t::is_drop_frame(fps);
+        return from_fields(tcstring_fields{ std::uint32_t(h), std::uint32_t(m), std::uint32_t(s), std::uint32_t(f), drop_frame }, fps);
+    }
+
+    template<vtm::traits::StringConstructible S>
+    static auto from_string(const S& tc, const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeInt
+    {
+        const string_view_t view(tc);
+        tcstring_fields fields;
+
+        const bool valid = parse_tcstring_fixed(view, fields);
+        VTM_ASSERT(valid == true, "cannot create new timecode object with invalid timecode string");
+
+        // Validated above, the digits are a byte shuffle away
+        __BasicTimecodeInt result = from_fields(fields, fps);
+        result._digits = parse_tcdigits(view.data());
+        return result;
+    }
+
+    // Whole frames from 00:00:00:00, drop-frame rates count real frames
+    static auto from_frames(const std::uint64_t frames, const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeInt
+    {
+        const auto nominal = static_cast<std::uint64_t>(fps_factory_t::to_rational(fps).nominal());
+        VTM_ASSERT(nominal > 0, "frame rate must be a non-zero rational value");
+
+        if (fps_factory_t::is_drop_frame(fps)) {
+            return from_digits(fields_to_tcdigits(dropframe_to_fields(frames, nominal)), fps);
+        }
+
+        const std::uint64_t secs = frames / nominal;
+        const tcstring_fields fields {
+            static_cast<std::uint32_t>(secs / 3600 % 100),
+            static_cast<std::uint32_t>(secs / 60 % 60),
+            static_cast<std::uint32_t>(secs % 60),
+            static_cast<std::uint32_t>(frames % nominal),
+            false
+        };
+
+        return from_digits(fields_to_tcdigits(fields), fps);
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
 ///////////////////////////////////////////////////////////////////////////
 //
 //  -- @SECTION Ctors, Dtors & Assignment --
@@ -100,24 +281,24 @@ public:
     __BasicTimecodeInt(const __BasicTimecodeInt& tc)
         : _fps(tc._fps)
         , _flags(tc._flags)
-        , _values(tc._values)
+        , _digits(tc._digits)
     {}
 
     __BasicTimecodeInt(__BasicTimecodeInt&& tc) noexcept
         : _fps(tc._fps)
         , _flags(tc._flags)
-        , _values(tc._values)
+        , _digits(tc._digits)
     {
         tc._fps = {};
         tc._flags = {};
-        tc._values = {};
+        tc._digits = {};
     }
 
     __BasicTimecodeInt& operator=(const __BasicTimecodeInt& tc)
     {
         this->_fps = tc._fps;
         this->_flags = tc._flags;
-        this->_values = tc._values;
+        this->_digits = tc._digits;
         return *this;
     }
 
@@ -125,27 +306,39 @@ public:
     {
         this->_fps = tc._fps;
         this->_flags = tc._flags;
-        this->_values = tc._values;
+        this->_digits = tc._digits;
         tc._fps = {};
         tc._flags = {};
-        tc._values = {};
+        tc._digits = {};
         return *this;
     }
 
+    // Integral values are frame counts, floating point values are ticks as
+    // used by __BasicTimecodeFloat
     template<TimecodePrimitive V>
-    explicit __BasicTimecodeInt(const V value, const fps_t fps = fps_factory_t::default_value()) noexcept
+    explicit __BasicTimecodeInt(const V value, const fps_t fps = fps_factory_t::default_value())
         : _fps(fps)
         , _flags(0)
-        , _values{}
+        , _digits{}
     {
-        VTM_TODO("not implemented");
-    }
+        if constexpr (std::integral<V>) {
+            VTM_ASSERT(value >= 0, "timecode frame count must be greater than or equal to zero");
+            *this = from_frames(static_cast<std::uint64_t>(value), fps);
+        }
 
-    explicit constexpr __BasicTimecodeInt(const string_view_t& tc)
-    {
-        VTM_TODO("not implemented");
+        else {
+            const tcstring_fields fields = ticks_to_fields(float_type(value),
+                                                           fps_factory_t::to_float(fps),
+                                                           fps_factory_t::is_drop_frame(fps));
+            this->_digits = fields_to_tcdigits(fields);
+            this->_flags[TC_FLAGS_DROPFRAME] = fields.drop_frame;
+        }
     }
 
+    explicit __BasicTimecodeInt(const string_view_t& tc)
+        : __BasicTimecodeInt(from_string(tc))
+    {}
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -158,20 +351,65 @@ public:
 public:
     void reset() noexcept
     {
-        for (std::size_t i = 0; i < TCSTRING_SIZE; ++i) {
-            this->_values[i] = 0;
-        }
+        this->_digits = 0;
     }
 
+    // The label as an owning string, the packed digits hold no text to view
     auto display() const -> display_t
     {
-        VTM_TODO("not implemented");
+        return string_type(*this);
     }
 
-    // TODO: Test that this doesn't stack overflow because of implicit type conversion
-    explicit operator string_view_t() const
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Accessors & Conversion Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    auto fps() const noexcept -> fps_t
     {
-        return string_type(*this);
+        return this->_fps;
+    }
+
+    auto is_drop_frame() const noexcept -> bool
+    {
+        return this->_flags[TC_FLAGS_DROPFRAME];
+    }
+
+    auto digits() const noexcept -> tcdigits_t
+    {
+        return this->_digits;
+    }
+
+    auto fields() const noexcept -> tcstring_fields
+    {
+        return tcdigits_to_fields(this->_digits, this->is_drop_frame());
+    }
+
+    // Whole frames from 00:00:00:00, drop-frame rates count real frames
+    auto frames() const -> std::uint64_t
+    {
+        const auto nominal = static_cast<std::uint64_t>(fps_factory_t::to_rational(this->_fps).nominal());
+        const tcstring_fields f = this->fields();
+
+        if (this->is_drop_frame()) return fields_to_dropframe(f, nominal);
+        return ((std::uint64_t(f.hours) * 60 + f.minutes) * 60 + f.seconds) * nominal + f.frames;
+    }
+
+    // Writes exactly 11 bytes to out, returns one past the last byte written
+    auto format_to(char* out) const -> char*
+    {
+        return format_tcdigits(out, this->_digits, this->is_drop_frame());
+    }
+
+    auto to_chars(char* first, char* last) const -> std::to_chars_result
+    {
+        if (last - first < VTM_TCSTRING_FIXED_SIZE) return { last, std::errc::value_too_large };
+        return { this->format_to(first), std::errc{} };
     }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -186,17 +424,113 @@ public:
 public:
     operator signed_type() const
     {
-        VTM_TODO("not implemented");
+        return static_cast<signed_type>(this->frames());
     }
 
+    // Same ticks as __BasicTimecodeFloat::from_string() with this label
     operator float_type() const
     {
-        VTM_TODO("not implemented");
+        const float_type fps_float = fps_factory_t::to_float(this->_fps);
+        if (this->is_drop_frame()) return float_type(this->frames()) / fps_float / float_type(100.0);
+        return fields_to_ticks(this->fields(), fps_to_ticks_by_chunk(fps_float));
     }
 
     operator string_type() const
     {
-        VTM_TODO("not implemented");
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        this->format_to(buffer);
+        return string_type(string_view_t(buffer, VTM_TCSTRING_FIXED_SIZE));
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Arithmetic & Assigment Operations --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Frames are added in binary against the nominal rate, the carry then
+    // ripples through seconds, minutes and hours in one SWAR add. Drop-frame
+    // labels skip frame numbers, so those go through the frame count instead.
+    // Hours wrap at 100 and subtraction clamps at zero
+    __BasicTimecodeInt& operator+=(const __BasicTimecodeInt& rhs)
+    {
+        VTM_ASSERT(this->_fps == rhs._fps, "cannot add timecodes with different frame rates");
+
+        if (this->is_drop_frame()) {
+            *this = from_frames(this->frames() + rhs.frames(), this->_fps);
+            return *this;
+        }
+
+        const auto nominal = static_cast<std::uint32_t>(fps_factory_t::to_rational(this->_fps).nominal());
+        std::uint32_t frames = tcdigits_frames(this->_digits) + tcdigits_frames(rhs._digits);
+        const tcdigits_t carry = frames >= nominal;
+        frames -= nominal * std::uint32_t(carry);
+
+        this->_digits = tcdigits_with_frames(tcdigits_add_upper(this->_digits, rhs._digits, carry), frames);
+        return *this;
+    }
+
+    __BasicTimecodeInt& operator-=(const __BasicTimecodeInt& rhs)
+    {
+        VTM_ASSERT(this->_fps == rhs._fps, "cannot subtract timecodes with different frame rates");
+
+        if (this->is_drop_frame()) {
+            const std::uint64_t lhs_frames = this->frames();
+            const std::uint64_t rhs_frames = rhs.frames();
+            *this = from_frames(lhs_frames > rhs_frames ? lhs_frames - rhs_frames : 0, this->_fps);
+            return *this;
+        }
+
+        const auto nominal = static_cast<std::uint32_t>(fps_factory_t::to_rational(this->_fps).nominal());
+        const std::uint32_t lhs_frames = tcdigits_frames(this->_digits);
+        const std::uint32_t rhs_frames = tcdigits_frames(rhs._digits);
+        const tcdigits_t borrow = lhs_frames < rhs_frames;
+        const std::uint32_t frames = lhs_frames + nominal * std::uint32_t(borrow) - rhs_frames;
+
+        tcdigits_t upper = 0;
+        if (!tcdigits_sub_upper(this->_digits, rhs._digits, borrow, upper)) {
+            this->_digits = 0;
+            return *this;
+        }
+
+        this->_digits = tcdigits_with_frames(upper, frames);
+        return *this;
+    }
+
+    friend __BasicTimecodeInt operator+(__BasicTimecodeInt lhs, const __BasicTimecodeInt& rhs)
+    {
+        return lhs += rhs;
+    }
+
+    friend __BasicTimecodeInt operator-(__BasicTimecodeInt lhs, const __BasicTimecodeInt& rhs)
+    {
+        return lhs -= rhs;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//  -- @SECTION Equality Comparison --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    bool operator==(const __BasicTimecodeInt& rhs) const
+    {
+        return this->_digits == rhs._digits && this->_fps == rhs._fps;
+    }
+
+    // Packed digits order like their labels, timecodes at different rates are unordered
+    auto operator<=>(const __BasicTimecodeInt& rhs) const -> std::partial_ordering
+    {
+        if (this->_fps != rhs._fps) return std::partial_ordering::unordered;
+        return this->_digits <=> rhs._digits;
     }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -209,21 +543,22 @@ public:
 ///////////////////////////////////////////////////////////////////////////
 
 private:
+    static auto from_digits(const tcdigits_t digits, const fps_t fps) noexcept -> __BasicTimecodeInt
+    {
+        __BasicTimecodeInt result;
+        result._fps = fps;
+        result._digits = digits;
+        result._flags[TC_FLAGS_DROPFRAME] = fps_factory_t::is_drop_frame(fps);
+        return result;
+    }
+
     fps_t _fps = fps_factory_t::default_value();
     flags_t _flags = 0;
-    std::uint8_t _values[TCSTRING_SIZE] = {0, 0, 0, 0};
+    tcdigits_t _digits = 0;
 };
 
-#undef TCSTRING_GROUP_WIDTH
-#undef TCSTRING_TOTAL_GROUPS
-#undef TCSTRING_SIZE
-#undef TCSTRING_COLON_DEFAULT
-#undef TCSTRING_COLON_DROPFRAME
-#undef TCSTRING_HRS_START
-#undef TCSTRING_MINS_START
-#undef TCSTRING_SECS_START
-#undef TCSTRING_FRAMES_START
 #undef TC_FLAGS_SIZE
+#undef TC_FLAGS_DROPFRAME
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,400 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Timecode library templates for exact rational implementation
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <charconv>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+// Project headers
+#include "errors.hpp"
+#include "timecode_common.hpp"
+#include "timecode_dropframe.hpp"
+#include "timecode_string.hpp"
+#include "traits.hpp"
+#include "utility.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef VTM_TIMECODE_RATIONAL_MACROS
+#define VTM_TIMECODE_RATIONAL_MACROS
+
+// Subframes per frame, matches the 1/100 frame tick of the floating point timecode
+#ifndef VTM_TIMECODE_SUBFRAMES
+#define VTM_TIMECODE_SUBFRAMES 100
+#endif
+
+#endif // @END OF VTM_TIMECODE_RATIONAL_MACROS
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono::internal {
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION __BasicTimecodeRational --
+//
+///////////////////////////////////////////////////////////////////////////
+
+// Timecode stored as a signed count of subframes at an exact num/den frame
+// rate. Arithmetic and comparison are integer only, so nothing drifts no matter
+// how many operations accumulate. Cross-rate products take out the common
+// divisor of the two rates first, which leaves factors of at most 5000 between
+// supported rates, so 64 bits hold ~2^50 subframes (thousands of years at 120
+// fps). Larger values assert instead of overflowing
+template<std::signed_integral TInt,
+         std::floating_point TFloat,
+         vtm::traits::StringLike TString,
+         vtm::traits::StringLike TView,
+         FpsFormatFactory TFps>
+class __BasicTimecodeRational : public vtm::traits::__convert_to_float<__BasicTimecodeRational<TInt, TFloat, TString, TView, TFps>, TFloat>
+                              , public vtm::traits::__convert_to_signed<__BasicTimecodeRational<TInt, TFloat, TString, TView, TFps>, TInt>
+                              , public vtm::traits::__convert_to_string<__BasicTimecodeRational<TInt, TFloat, TString, TView, TFps>, TString>
+{
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Type Aliases --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    using __my_type     = __BasicTimecodeRational<TInt, TFloat, TString, TView, TFps>;
+    using string_t      = std::remove_cvref_t<TString>;
+    using string_view_t = std::remove_cvref_t<TView>;
+    using signed_type   = typename vtm::traits::__convert_to_signed<__my_type, TInt>::signed_type;
+    using float_type    = typename vtm::traits::__convert_to_float<__my_type, TFloat>::float_type;
+    using string_type   = typename vtm::traits::__convert_to_string<__my_type, string_t>::string_type;
+    using fps_factory_t = TFps;
+    using fps_t         = typename TFps::type;
+    using rational_t    = __FPSRational<typename TFps::int_type>;
+
+    static constexpr signed_type subframes_per_frame = VTM_TIMECODE_SUBFRAMES;
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Static Methods --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    static auto from_frames(const signed_type frames,
+                            const signed_type subframes = 0,
+                            const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeRational
+    {
+        return __BasicTimecodeRational{ frames * subframes_per_frame + subframes, fps };
+    }
+
+    template<std::integral V>
+    static auto from_hmsf(const V h,
+                          const V m,
+                          const V s,
+                          const V f,
+                          const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeRational
+    {
+        VTM_ASSERT(h >= 0, "timecode hours must be greater than or equal to zero");
+        VTM_ASSERT(m >= 0, "timecode minutes must be greater than or equal zero");
+        VTM_ASSERT(s >= 0, "timecode seconds must be greater than or equal zero");
+        VTM_ASSERT(f >= 0, "timecode frames must be greater than or equal zero");
+
+        const signed_type nominal = nominal_rate(fps);
+
+        if (fps_factory_t::is_drop_frame(fps)) {
+            const tcstring_fields fields{ std::uint32_t(h), std::uint32_t(m), std::uint32_t(s), std::uint32_t(f), true };
+            VTM_ASSERT(valid_dropframe_fields(fields, nominal) == true, "invalid drop-frame timecode");
+            return from_frames(signed_type(fields_to_dropframe(fields, nominal)), 0, fps);
+        }
+
+        const signed_type label_secs = (signed_type(h) * 60 + signed_type(m)) * 60 + signed_type(s);
+        return from_frames(label_secs * nominal + signed_type(f), 0, fps);
+    }
+
+    template<vtm::traits::StringConstructible S>
+    static auto from_string(const S& tc, const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeRational
+    {
+        tcstring_fields fields;
+        const bool valid = parse_tcstring_fixed(string_view_t(tc), fields);
+        VTM_ASSERT(valid == true, "cannot create new timecode object with invalid timecode string");
+        return from_hmsf(fields.hours, fields.minutes, fields.seconds, fields.frames, fps);
+    }
+
+    // Floating point ticks of __BasicTimecodeFloat, split on label seconds so
+    // that the "HH:MM:SS:FF" label is preserved at every frame rate
+    static auto from_ticks(const float_type ticks, const fps_t fps = fps_factory_t::default_value()) -> __BasicTimecodeRational
+    {
+        const float_type fps_float = fps_factory_t::to_float(fps);
+        VTM_ASSERT(fps_float > 0.0, "frame rate must be a non-zero floating point value");
+
+        const float_type secs = std::max(float_type(0.0), ticks * float_type(100.0));
+
+        // Drop-frame ticks count real frames, no label seconds to split on
+        if (fps_factory_t::is_drop_frame(fps)) {
+            return __BasicTimecodeRational{ static_cast<signed_type>(secs * fps_float * subframes_per_frame + float_type(0.5)), fps };
+        }
+
+        const float_type half_subframe = float_type(0.5) / (fps_float * subframes_per_frame);
+        const auto label_secs = static_cast<signed_type>(secs + half_subframe);
+        const auto subframes = static_cast<signed_type>((secs - float_type(label_secs)) * fps_float * subframes_per_frame + float_type(0.5));
+
+        return __BasicTimecodeRational{ label_secs * nominal_rate(fps) * subframes_per_frame + std::max(signed_type(0), subframes), fps };
+    }
+
+    static auto nominal_rate(const fps_t fps) -> signed_type
+    {
+        const signed_type nominal = fps_factory_t::to_rational(fps).nominal();
+        VTM_ASSERT(nominal > 0, "frame rate must be a non-zero rational value");
+        return nominal;
+    }
+
+    // a / b reduced to lowest terms, the factors of a cross-rate product
+    static auto cross_factors(const signed_type a, const signed_type b) noexcept -> std::pair<signed_type, signed_type>
+    {
+        const signed_type g = std::gcd(a, b);
+        return { a / g, b / g };
+    }
+
+    static auto scaled(const signed_type value, const signed_type factor) -> signed_type
+    {
+        VTM_ASSERT(value >= -(std::numeric_limits<signed_type>::max() / factor) && value <= std::numeric_limits<signed_type>::max() / factor,
+                   "rational timecode is too large for a cross-rate product");
+        return value * factor;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Ctors, Dtors & Assignment --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    __BasicTimecodeRational() = default;
+    ~__BasicTimecodeRational() = default;
+    __BasicTimecodeRational(const __BasicTimecodeRational&) = default;
+    __BasicTimecodeRational(__BasicTimecodeRational&&) noexcept = default;
+    __BasicTimecodeRational& operator=(const __BasicTimecodeRational&) = default;
+    __BasicTimecodeRational& operator=(__BasicTimecodeRational&&) noexcept = default;
+
+    template<std::integral V>
+    explicit constexpr __BasicTimecodeRational(const V subframes, const fps_t fps = fps_factory_t::default_value()) noexcept
+        : _value(subframes)
+        , _fps(fps)
+    {}
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Accessors & Mutators --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    auto subframes() const noexcept -> signed_type { return this->_value; }
+
+    auto frames() const noexcept -> signed_type { return this->_value / subframes_per_frame; }
+
+    auto fps() const noexcept -> fps_t { return this->_fps; }
+
+    auto rate() const -> rational_t { return fps_factory_t::to_rational(this->_fps); }
+
+    auto is_drop_frame() const noexcept -> bool { return fps_factory_t::is_drop_frame(this->_fps); }
+
+    // Wall clock duration, the only conversion that needs the exact num/den rate
+    auto seconds() const -> float_type
+    {
+        const rational_t r = this->rate();
+        return float_type(this->_value) * float_type(r.den) / (float_type(r.num) * subframes_per_frame);
+    }
+
+    // Exact conversion to another frame rate, rounded to the nearest subframe
+    auto to_fps(const fps_t fps) const -> __BasicTimecodeRational
+    {
+        if (fps == this->_fps) return *this;
+
+        const rational_t from = this->rate();
+        const rational_t to = fps_factory_t::to_rational(fps);
+        const auto [factor, d] = cross_factors(from.den * to.num, from.num * to.den);
+        const signed_type n = scaled(this->_value, factor);
+        return __BasicTimecodeRational{ (n + d / 2) / d, fps };
+    }
+
+    auto fields() const -> tcstring_fields
+    {
+        const signed_type nominal = nominal_rate(this->_fps);
+        const signed_type frames = std::max(signed_type(0), this->frames());
+        if (this->is_drop_frame()) return dropframe_to_fields(std::uint64_t(frames), std::uint64_t(nominal));
+
+        const signed_type label_secs = frames / nominal;
+
+        return tcstring_fields {
+            static_cast<std::uint32_t>(label_secs / 3600),
+            static_cast<std::uint32_t>(label_secs / 60 % 60),
+            static_cast<std::uint32_t>(label_secs % 60),
+            static_cast<std::uint32_t>(frames % nominal),
+            this->is_drop_frame()
+        };
+    }
+
+    auto format_to(char* out) const -> char*
+    {
+        return format_tcstring_fixed(out, this->fields());
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+// -- @SECTION Implicit Type Conversions --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Whole frames
+    operator signed_type() const
+    {
+        return this->frames();
+    }
+
+    // Floating point ticks, inverse of from_ticks()
+    operator float_type() const
+    {
+        if (this->is_drop_frame()) {
+            return float_type(this->_value) / (fps_factory_t::to_float(this->_fps) * subframes_per_frame * float_type(100.0));
+        }
+
+        const signed_type per_sec = nominal_rate(this->_fps) * subframes_per_frame;
+        const signed_type label_secs = this->_value / per_sec;
+        const signed_type rem = this->_value % per_sec;
+        const float_type fps_float = fps_factory_t::to_float(this->_fps);
+
+        return float_type(label_secs) / float_type(100.0)
+             + float_type(rem) / (fps_float * subframes_per_frame * float_type(100.0));
+    }
+
+    operator string_type() const
+    {
+        char buffer[VTM_TCSTRING_FIXED_SIZE];
+        this->format_to(buffer);
+        return string_type(string_view_t(buffer, VTM_TCSTRING_FIXED_SIZE));
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Arithmetic & Assigment Operations --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Integral operands are raw subframes, timecode operands are converted to
+    // the left hand side's frame rate. Results never go below zero
+    __BasicTimecodeRational& operator+=(const __BasicTimecodeRational& rhs)
+    {
+        this->_value += rhs.to_fps(this->_fps)._value;
+        return *this;
+    }
+
+    __BasicTimecodeRational& operator-=(const __BasicTimecodeRational& rhs)
+    {
+        this->_value = std::max(signed_type(0), this->_value - rhs.to_fps(this->_fps)._value);
+        return *this;
+    }
+
+    template<std::integral V>
+    __BasicTimecodeRational& operator+=(const V rhs)
+    {
+        this->_value = std::max(signed_type(0), this->_value + signed_type(rhs));
+        return *this;
+    }
+
+    template<std::integral V>
+    __BasicTimecodeRational& operator-=(const V rhs)
+    {
+        this->_value = std::max(signed_type(0), this->_value - signed_type(rhs));
+        return *this;
+    }
+
+    friend __BasicTimecodeRational operator+(__BasicTimecodeRational lhs, const auto& rhs)
+    {
+        return lhs += rhs;
+    }
+
+    friend __BasicTimecodeRational operator-(__BasicTimecodeRational lhs, const auto& rhs)
+    {
+        return lhs -= rhs;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Equality Comparison --
+//
+///////////////////////////////////////////////////////////////////////////
+
+public:
+    // Same instant at the same rate, like __BasicTimecodeFloat
+    bool operator==(const __BasicTimecodeRational& rhs) const
+    {
+        return this->_value == rhs._value && this->_fps == rhs._fps;
+    }
+
+    // Total order on wall clock time, exact across frame rates by cross multiplying
+    auto operator<=>(const __BasicTimecodeRational& rhs) const -> std::strong_ordering
+    {
+        if (this->_fps == rhs._fps) {
+            if (const auto cmp = this->_value <=> rhs._value; cmp != 0) return cmp;
+            return std::strong_ordering::equal;
+        }
+
+        const rational_t l = this->rate();
+        const rational_t r = rhs.rate();
+        const auto [lf, rf] = cross_factors(l.den * r.num, r.den * l.num);
+        if (const auto cmp = scaled(this->_value, lf) <=> scaled(rhs._value, rf); cmp != 0) return cmp;
+        return this->_fps <=> rhs._fps;
+    }
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Private Data Members --
+//
+///////////////////////////////////////////////////////////////////////////
+
+private:
+    signed_type _value = 0;
+    fps_t _fps = fps_factory_t::default_value();
+};
+
+///////////////////////////////////////////////////////////////////////////
+
+} // @END OF namespace vtm::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,287 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Frame rate independent ordering keys and radix sorting for timecodes
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Project headers
+#include "errors.hpp"
+#include "timecode_column.hpp"
+#include "timecode_common.hpp"
+#include "timecode_rational.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef VTM_TIMECODE_SORT_MACROS
+#define VTM_TIMECODE_SORT_MACROS
+
+// Ordering keys count flicks, 1/705600000 of a second. Every supported frame
+// duration, including 1001/30000, is a whole number of flicks
+#define VTM_TIMECODE_FLICKS_PER_SECOND 705600000
+
+#endif // @END OF VTM_TIMECODE_SORT_MACROS
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Ordering Keys --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono {
+
+// Absolute time as an unsigned integer. Keys order timecodes of any frame rate
+// against each other, where operator<=> reports them unordered
+using tcorder_key_t = std::uint64_t;
+
+// @SECTION: Key of a tick value. Negative and NaN ticks map to zero, values past
+// the key range saturate
+template<std::floating_point F>
+inline auto ordering_key(const F ticks) noexcept -> tcorder_key_t
+{
+    constexpr F flicks_per_tick = F(100.0) * F(VTM_TIMECODE_FLICKS_PER_SECOND);
+    constexpr F key_max = F(std::numeric_limits<tcorder_key_t>::max() / 2);
+
+    const F flicks = ticks * flicks_per_tick;
+    if (!(flicks > F(0.0))) return 0;
+    if (flicks >= key_max) return static_cast<tcorder_key_t>(key_max);
+    return static_cast<tcorder_key_t>(flicks + F(0.5));
+}
+
+// @SECTION: Key of a subframe count at an exact num/den rate. Frame boundaries
+// are exact, subframes round to the nearest flick
+template<typename TRational>
+inline auto ordering_key(const tcorder_key_t subframes, const TRational& rate) noexcept -> tcorder_key_t
+{
+    const auto per_frame = static_cast<tcorder_key_t>(VTM_TIMECODE_FLICKS_PER_SECOND) * tcorder_key_t(rate.den);
+    const tcorder_key_t flicks_per_frame = (per_frame + tcorder_key_t(rate.num) / 2) / tcorder_key_t(rate.num);
+    const tcorder_key_t frames = subframes / VTM_TIMECODE_SUBFRAMES;
+    const tcorder_key_t rem = subframes % VTM_TIMECODE_SUBFRAMES;
+
+    return frames * flicks_per_frame + (rem * flicks_per_frame + VTM_TIMECODE_SUBFRAMES / 2) / VTM_TIMECODE_SUBFRAMES;
+}
+
+// @SECTION: Key of a floating point timecode. Ticks of non-drop rates count
+// label seconds, so they are split into frames like r64timecode::from_ticks()
+// and keyed at the exact rate, 01:00:00:00 at 29.97 is 3603.6 s as with r64.
+// Timecodes without a rate are keyed on their ticks
+template<typename TTimecode>
+requires requires(const TTimecode& tc) { { tc.as_float() } -> std::floating_point; tc.fps(); typename TTimecode::fps_factory_t; }
+      && (!requires(const TTimecode& tc) { tc.subframes(); })
+inline auto ordering_key(const TTimecode& tc) -> tcorder_key_t
+{
+    using fps_factory_t = typename TTimecode::fps_factory_t;
+    using float_t = std::remove_cvref_t<decltype(tc.as_float())>;
+    constexpr float_t key_max = float_t(std::numeric_limits<tcorder_key_t>::max() / 2);
+    constexpr float_t subframes_per_frame = float_t(VTM_TIMECODE_SUBFRAMES);
+
+    const auto fps = tc.fps();
+    const float_t fps_float = float_t(fps_factory_t::to_float(fps));
+    if (!(fps_float > float_t(0.0))) return ordering_key(tc.as_float());
+
+    const float_t secs = tc.as_float() * float_t(100.0);
+    if (!(secs > float_t(0.0))) return 0;
+
+    // Drop-frame ticks count real frames, no label seconds to split on
+    float_t frames = secs * fps_float;
+    if (!fps_factory_t::is_drop_frame(fps)) {
+        const float_t label_secs = std::floor(secs + float_t(0.5) / (fps_float * subframes_per_frame));
+        frames = label_secs * float_t(fps_factory_t::to_nominal(fps)) + std::max(float_t(0.0), (secs - label_secs) * fps_float);
+    }
+
+    const auto rate = fps_factory_t::to_rational(fps);
+    if (frames * float_t(VTM_TIMECODE_FLICKS_PER_SECOND) * float_t(rate.den) / float_t(rate.num) >= key_max) return static_cast<tcorder_key_t>(key_max);
+    return ordering_key(static_cast<tcorder_key_t>(frames * subframes_per_frame + float_t(0.5)), rate);
+}
+
+// @SECTION: Key of an exact rational timecode
+template<typename TTimecode>
+requires requires(const TTimecode& tc) { tc.subframes(); tc.rate(); }
+inline auto ordering_key(const TTimecode& tc) -> tcorder_key_t
+{
+    return ordering_key(static_cast<tcorder_key_t>(std::max<decltype(tc.subframes())>(0, tc.subframes())), tc.rate());
+}
+
+template<typename TTimecode>
+concept OrderedTimecode = requires(const TTimecode& tc) { { ordering_key(tc) } -> std::same_as<tcorder_key_t>; };
+
+} // @END OF namespace vtm::chrono
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION LSD Radix Sort --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono::internal {
+
+// @SECTION: Stable LSD radix sort of keys with a payload carried along. Keys are
+// rebased on the smallest key and shifted past the trailing zero bits they all
+// share, so only the bits that differ are sorted, in 11-bit digits. A single
+// rate day of frame aligned keys takes four scatters
+template<std::unsigned_integral P>
+inline auto radix_sort_pairs(std::span<tcorder_key_t> keys, std::span<P> payload) -> void
+{
+    VTM_ASSERT(keys.size() == payload.size(), "radix sort keys and payload differ in size");
+
+    constexpr std::size_t digit_bits = 11;
+    constexpr std::size_t buckets = std::size_t{1} << digit_bits;
+    const std::size_t n = keys.size();
+    if (n < 2) return;
+
+    tcorder_key_t lo = keys[0];
+    tcorder_key_t hi = keys[0];
+    tcorder_key_t any_bits = 0;
+    for (const tcorder_key_t key : keys) {
+        lo = std::min(lo, key);
+        hi = std::max(hi, key);
+        any_bits |= key;
+    }
+
+    if (lo == hi) return;
+
+    const int shift = std::countr_zero(any_bits);
+    const std::size_t passes = (std::size_t(std::bit_width((hi - lo) >> shift)) + digit_bits - 1) / digit_bits;
+    const auto digit = [&](const tcorder_key_t key, const std::size_t pass) -> std::size_t {
+        return std::size_t(((key - lo) >> shift) >> (pass * digit_bits)) & (buckets - 1);
+    };
+
+    std::vector<std::size_t> counts(passes * buckets, 0);
+    for (const tcorder_key_t key : keys) {
+        for (std::size_t pass = 0; pass < passes; ++pass) ++counts[pass * buckets + digit(key, pass)];
+    }
+
+    std::vector<tcorder_key_t> key_scratch(n);
+    std::vector<P> payload_scratch(n);
+
+    tcorder_key_t* key_src = keys.data();
+    tcorder_key_t* key_dst = key_scratch.data();
+    P* payload_src = payload.data();
+    P* payload_dst = payload_scratch.data();
+
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        std::size_t* count = counts.data() + pass * buckets;
+        if (count[digit(key_src[0], pass)] == n) continue;
+
+        std::size_t offset = 0;
+        for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+            const std::size_t size = count[bucket];
+            count[bucket] = offset;
+            offset += size;
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::size_t at = count[digit(key_src[i], pass)]++;
+            key_dst[at] = key_src[i];
+            payload_dst[at] = payload_src[i];
+        }
+
+        std::swap(key_src, key_dst);
+        std::swap(payload_src, payload_dst);
+    }
+
+    if (key_src != keys.data()) {
+        std::copy(key_src, key_src + n, keys.data());
+        std::copy(payload_src, payload_src + n, payload.data());
+    }
+}
+
+} // @END OF namespace vtm::chrono::internal
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Timecode Sorting --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono {
+
+// @SECTION: Sorts (key, payload) pairs by key, equal keys keep their input order
+template<std::unsigned_integral P>
+inline auto radix_sort(std::span<tcorder_key_t> keys, std::span<P> payload) -> void
+{
+    internal::radix_sort_pairs(keys, payload);
+}
+
+// @SECTION: Stable permutation putting tcs in time order, i.e. the payload indexes
+// of sorted (timecode, index) pairs. Mixed frame rates are ordered by absolute time
+template<OrderedTimecode TTimecode>
+inline auto sorted_order(std::span<const TTimecode> tcs) -> std::vector<std::uint32_t>
+{
+    VTM_ASSERT(tcs.size() <= std::numeric_limits<std::uint32_t>::max(), "too many timecodes for 32-bit sort indexes");
+
+    std::vector<tcorder_key_t> keys(tcs.size());
+    std::vector<std::uint32_t> order(tcs.size());
+    for (std::size_t i = 0; i < tcs.size(); ++i) keys[i] = ordering_key(tcs[i]);
+    std::iota(order.begin(), order.end(), std::uint32_t{0});
+
+    internal::radix_sort_pairs(std::span<tcorder_key_t>(keys), std::span<std::uint32_t>(order));
+    return order;
+}
+
+template<typename TTimecode>
+inline auto sorted_order(const internal::__BasicTimecodeColumn<TTimecode>& column) -> std::vector<std::uint32_t>
+{
+    VTM_ASSERT(column.size() <= std::numeric_limits<std::uint32_t>::max(), "too many timecodes for 32-bit sort indexes");
+
+    const auto values = column.values();
+    std::vector<tcorder_key_t> keys(values.size());
+    std::vector<std::uint32_t> order(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) keys[i] = ordering_key(values[i]);
+    std::iota(order.begin(), order.end(), std::uint32_t{0});
+
+    internal::radix_sort_pairs(std::span<tcorder_key_t>(keys), std::span<std::uint32_t>(order));
+    return order;
+}
+
+// @SECTION: Sorts tcs in place by absolute time, stable
+template<OrderedTimecode TTimecode>
+inline auto sort_timecodes(std::span<TTimecode> tcs) -> void
+{
+    const auto order = sorted_order(std::span<const TTimecode>(tcs));
+
+    std::vector<TTimecode> sorted;
+    sorted.reserve(tcs.size());
+    for (const std::uint32_t i : order) sorted.push_back(tcs[i]);
+    std::copy(sorted.begin(), sorted.end(), tcs.begin());
+}
+
+template<typename TTimecode>
+inline auto sort_timecodes(internal::__BasicTimecodeColumn<TTimecode>& column) -> void
+{
+    const auto order = sorted_order(column);
+    const auto values = column.values();
+
+    std::vector<typename internal::__BasicTimecodeColumn<TTimecode>::storage_type> sorted(values.size());
+    for (std::size_t i = 0; i < order.size(); ++i) sorted[i] = values[order[i]];
+    std::copy(sorted.begin(), sorted.end(), values.begin());
+}
+
+} // @END OF namespace vtm::chrono
+
+///////////////////////////////////////////////////////////////////////////
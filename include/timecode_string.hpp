@@ -0,0 +1,356 @@
+// Copyright (C) Stefan Olivier
+// <https://stefanolivier.com>
+// ----------------------------
+// Description: Fixed-width timecode string kernels
+
+#pragma once
+
+///////////////////////////////////////////////////////////////////////////
+
+// Standard headers
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+
+// Platform headers
+#if defined(__AVX2__) || defined(__SSSE3__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef VTM_TIMECODE_STRING_MACROS
+#define VTM_TIMECODE_STRING_MACROS
+
+// Byte length of the fixed "HH:MM:SS:FF" / "HH:MM:SS;FF" layout
+#define VTM_TCSTRING_FIXED_SIZE 11
+
+// Kernel selection, define VTM_TIMECODE_NO_SIMD to force the SWAR kernel
+#if !defined(VTM_TIMECODE_NO_SIMD) && defined(__AVX2__)
+#define VTM_TIMECODE_SIMD_AVX2 1
+#endif
+
+#if !defined(VTM_TIMECODE_NO_SIMD) && (defined(__SSSE3__) || defined(__AVX__))
+#define VTM_TIMECODE_SIMD_SSSE3 1
+#endif
+
+#endif // @END OF VTM_TIMECODE_STRING_MACROS
+
+///////////////////////////////////////////////////////////////////////////
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Fixed-Width Timecode String Parsing --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono {
+
+// @SECTION: Decoded fields of a fixed-width timecode string
+struct tcstring_fields
+{
+    std::uint32_t hours   = 0;
+    std::uint32_t minutes = 0;
+    std::uint32_t seconds = 0;
+    std::uint32_t frames  = 0;
+    bool drop_frame       = false;
+};
+
+} // @END OF namespace vtm::chrono
+
+namespace vtm::chrono::internal {
+
+// Digits sit at every position except the delimiters at 2, 5 and 8. The frame
+// delimiter may be ':' or ';', the remaining delimiters may only be ';' when
+// the frame delimiter is also ';' (e.g. "HH;MM;SS;FF")
+inline constexpr std::array<std::size_t, 8> tcstring_digit_positions{ 0, 1, 3, 4, 6, 7, 9, 10 };
+
+constexpr auto is_tcstring_delimiter(const char c) noexcept -> bool
+{
+    return c == ':' || c == ';';
+}
+
+constexpr auto fields_from_digits(const std::array<std::uint32_t, 8>& d, bool drop_frame) noexcept -> tcstring_fields
+{
+    return tcstring_fields {
+        d[0] * 10 + d[1],
+        d[2] * 10 + d[3],
+        d[4] * 10 + d[5],
+        d[6] * 10 + d[7],
+        drop_frame
+    };
+}
+
+// @SECTION: Scalar kernel, usable in constant expressions
+constexpr auto parse_tcstring_fixed_scalar(const char* tc, tcstring_fields& out) noexcept -> bool
+{
+    const char fd = tc[8];
+    if (!is_tcstring_delimiter(fd)) return false;
+    if (tc[2] != ':' && tc[2] != fd) return false;
+    if (tc[5] != ':' && tc[5] != fd) return false;
+
+    std::array<std::uint32_t, 8> digits{};
+    for (std::size_t i = 0; i < tcstring_digit_positions.size(); ++i) {
+        const char c = tc[tcstring_digit_positions[i]];
+        if (c < '0' || c > '9') return false;
+        digits[i] = static_cast<std::uint32_t>(c - '0');
+    }
+
+    out = fields_from_digits(digits, fd == ';');
+    return true;
+}
+
+// @SECTION: SWAR kernel over two little-endian 64-bit words
+inline auto parse_tcstring_fixed_swar(const char* tc, tcstring_fields& out) noexcept -> bool
+{
+    static_assert(std::endian::native == std::endian::little, "SWAR timecode kernel requires a little-endian target");
+
+    std::uint64_t lo = 0;
+    std::uint64_t hi = 0;
+    std::memcpy(&lo, tc, 8);
+    std::memcpy(&hi, tc + 8, 3);
+
+    // XOR against the expected layout leaves digits as 0-9 and ':' as 0 (';' as 1)
+    constexpr std::uint64_t expect_lo = 0x30303A30303A3030ull; // "00:00:00"
+    constexpr std::uint64_t expect_hi = 0x000000000030303Aull; // ":00"
+    const std::uint64_t d_lo = lo ^ expect_lo;
+    const std::uint64_t d_hi = hi ^ expect_hi;
+
+    // Per-byte upper bounds expressed as (0x7F - bound): digits <= 9, delimiters <= 1, padding == 0
+    constexpr std::uint64_t bound_lo = 0x76767E76767E7676ull;
+    constexpr std::uint64_t bound_hi = 0x7F7F7F7F7F76767Eull;
+    constexpr std::uint64_t high_bits = 0x8080808080808080ull;
+    constexpr std::uint64_t low_bits = 0x7F7F7F7F7F7F7F7Full;
+
+    const std::uint64_t over_lo = (((d_lo & low_bits) + bound_lo) | d_lo) & high_bits;
+    const std::uint64_t over_hi = (((d_hi & low_bits) + bound_hi) | d_hi) & high_bits;
+    if ((over_lo | over_hi) != 0) return false;
+
+    // Hour and minute delimiters may only be ';' when the frame delimiter is ';'
+    const std::uint64_t fd = d_hi & 0xFF;
+    if ((((d_lo >> 16) | (d_lo >> 40)) & 0xFF) > fd) return false;
+
+    const auto at = [](std::uint64_t w, unsigned byte) { return static_cast<std::uint32_t>((w >> (byte * 8)) & 0xFF); };
+    out = tcstring_fields {
+        at(d_lo, 0) * 10 + at(d_lo, 1),
+        at(d_lo, 3) * 10 + at(d_lo, 4),
+        at(d_lo, 6) * 10 + at(d_lo, 7),
+        at(d_hi, 1) * 10 + at(d_hi, 2),
+        fd == 1
+    };
+
+    return true;
+}
+
+#if defined(VTM_TIMECODE_SIMD_SSSE3)
+
+// Expected layout, per-byte upper bounds and digit gather shared by the SSE and AVX2 kernels
+#define __VTM_TCSTRING_SIMD_EXPECT   '0', '0', ':', '0', '0', ':', '0', '0', ':', '0', '0', 0, 0, 0, 0, 0
+#define __VTM_TCSTRING_SIMD_BOUNDS     9,   9,   1,   9,   9,   1,   9,   9,   1,   9,   9, 0, 0, 0, 0, 0
+#define __VTM_TCSTRING_SIMD_GATHER     0,   1,   3,   4,   6,   7,   9,  10,  -1,  -1,  -1, -1, -1, -1, -1, -1
+#define __VTM_TCSTRING_SIMD_WEIGHTS   10,   1,  10,   1,  10,   1,  10,   1,   0,   0,   0, 0, 0, 0, 0, 0
+
+// @SECTION: SSSE3 kernel, validates all 16 lanes with a saturating subtract
+// and folds digit pairs with a multiply-add
+inline auto parse_tcstring_fixed_sse(const char* tc, tcstring_fields& out) noexcept -> bool
+{
+    alignas(16) char buffer[16] = {};
+    std::memcpy(buffer, tc, VTM_TCSTRING_FIXED_SIZE);
+
+    const __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(buffer));
+    const __m128i d = _mm_xor_si128(v, _mm_setr_epi8(__VTM_TCSTRING_SIMD_EXPECT));
+    const __m128i over = _mm_subs_epu8(d, _mm_setr_epi8(__VTM_TCSTRING_SIMD_BOUNDS));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(over, _mm_setzero_si128())) != 0xFFFF) return false;
+
+    const int fd = _mm_extract_epi16(d, 4) & 0xFF;
+    if (((_mm_extract_epi16(d, 1) | (_mm_extract_epi16(d, 2) >> 8)) & 0xFF) > fd) return false;
+
+    const __m128i digits = _mm_shuffle_epi8(d, _mm_setr_epi8(__VTM_TCSTRING_SIMD_GATHER));
+    const __m128i pairs = _mm_maddubs_epi16(digits, _mm_setr_epi8(__VTM_TCSTRING_SIMD_WEIGHTS));
+    const auto packed = static_cast<std::uint64_t>(_mm_cvtsi128_si64(pairs));
+
+    out = tcstring_fields {
+        static_cast<std::uint32_t>(packed & 0xFFFF),
+        static_cast<std::uint32_t>((packed >> 16) & 0xFFFF),
+        static_cast<std::uint32_t>((packed >> 32) & 0xFFFF),
+        static_cast<std::uint32_t>(packed >> 48),
+        fd == 1
+    };
+
+    return true;
+}
+
+#endif // @END OF VTM_TIMECODE_SIMD_SSSE3
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+
+// @SECTION: AVX2 kernel, parses two timecode strings per 256-bit register.
+// Returns a two-bit mask of which inputs were valid
+inline auto parse_tcstring_fixed_avx2(const char* tc0,
+                                      const char* tc1,
+                                      tcstring_fields& out0,
+                                      tcstring_fields& out1) noexcept -> unsigned
+{
+    alignas(32) char buffer[32] = {};
+    std::memcpy(buffer, tc0, VTM_TCSTRING_FIXED_SIZE);
+    std::memcpy(buffer + 16, tc1, VTM_TCSTRING_FIXED_SIZE);
+
+    const __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(buffer));
+    const __m256i d = _mm256_xor_si256(v, _mm256_setr_epi8(__VTM_TCSTRING_SIMD_EXPECT, __VTM_TCSTRING_SIMD_EXPECT));
+    const __m256i over = _mm256_subs_epu8(d, _mm256_setr_epi8(__VTM_TCSTRING_SIMD_BOUNDS, __VTM_TCSTRING_SIMD_BOUNDS));
+    const auto ok = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(over, _mm256_setzero_si256())));
+
+    const __m256i digits = _mm256_shuffle_epi8(d, _mm256_setr_epi8(__VTM_TCSTRING_SIMD_GATHER, __VTM_TCSTRING_SIMD_GATHER));
+    const __m256i pairs = _mm256_maddubs_epi16(digits, _mm256_setr_epi8(__VTM_TCSTRING_SIMD_WEIGHTS, __VTM_TCSTRING_SIMD_WEIGHTS));
+
+    alignas(32) std::uint8_t dbytes[32];
+    alignas(32) std::uint16_t fields[16];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(dbytes), d);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(fields), pairs);
+
+    unsigned valid = 0;
+    tcstring_fields* outs[2] = { &out0, &out1 };
+    for (unsigned lane = 0; lane < 2; ++lane) {
+        const std::uint8_t* db = dbytes + lane * 16;
+        const std::uint16_t* fb = fields + lane * 8;
+        const bool lane_ok = ((ok >> (lane * 16)) & 0xFFFF) == 0xFFFF && (db[2] | db[5]) <= db[8];
+        if (!lane_ok) continue;
+
+        *outs[lane] = tcstring_fields{ fb[0], fb[1], fb[2], fb[3], db[8] == 1 };
+        valid |= 1u << lane;
+    }
+
+    return valid;
+}
+
+#endif // @END OF VTM_TIMECODE_SIMD_AVX2
+
+#undef __VTM_TCSTRING_SIMD_EXPECT
+#undef __VTM_TCSTRING_SIMD_BOUNDS
+#undef __VTM_TCSTRING_SIMD_GATHER
+#undef __VTM_TCSTRING_SIMD_WEIGHTS
+
+} // @END OF namespace vtm::chrono::internal
+
+namespace vtm::chrono {
+
+// @SECTION: Validating single-pass parser for the fixed 11-byte layout.
+// Returns false without touching `out` if the string is malformed
+constexpr auto parse_tcstring_fixed(const char* tc, tcstring_fields& out) noexcept -> bool
+{
+    if (std::is_constant_evaluated()) {
+        return internal::parse_tcstring_fixed_scalar(tc, out);
+    }
+
+#if defined(VTM_TIMECODE_SIMD_SSSE3)
+    return internal::parse_tcstring_fixed_sse(tc, out);
+#else
+    return internal::parse_tcstring_fixed_swar(tc, out);
+#endif
+}
+
+template<typename S>
+constexpr auto parse_tcstring_fixed(const S& tc, tcstring_fields& out) noexcept -> bool
+{
+    if (tc.size() != VTM_TCSTRING_FIXED_SIZE) return false;
+    return parse_tcstring_fixed(tc.data(), out);
+}
+
+} // @END OF namespace vtm::chrono
+
+
+///////////////////////////////////////////////////////////////////////////
+//
+//           -- @SECTION Fixed-Width Timecode String Formatting --
+//
+///////////////////////////////////////////////////////////////////////////
+
+namespace vtm::chrono::internal {
+
+// "00" to "99" packed back to back, indexed by (value * 2)
+inline constexpr auto tcstring_digit_pairs = []() {
+    std::array<char, 200> table{};
+    for (std::size_t i = 0; i < 100; ++i) {
+        table[i * 2]     = static_cast<char>('0' + i / 10);
+        table[i * 2 + 1] = static_cast<char>('0' + i % 10);
+    }
+    return table;
+}();
+
+constexpr auto write_digit_pair(char* out, const std::uint32_t value) noexcept -> void
+{
+    const char* pair = tcstring_digit_pairs.data() + (value % 100) * 2;
+    out[0] = pair[0];
+    out[1] = pair[1];
+}
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+
+// @SECTION: AVX2 kernel, formats four timecodes with one divide-by-ten over
+// sixteen 16-bit lanes. Writes 44 bytes through 16-byte stores, so `out` must
+// have at least 49 writable bytes
+inline auto format_tcstring_fixed_avx2(char* out, const tcstring_fields* fields) noexcept -> char*
+{
+    const auto f = [fields](std::size_t i) { return fields[i]; };
+    const __m256i v = _mm256_setr_epi16(
+        short(f(0).hours % 100), short(f(0).minutes), short(f(0).seconds), short(f(0).frames),
+        short(f(1).hours % 100), short(f(1).minutes), short(f(1).seconds), short(f(1).frames),
+        short(f(2).hours % 100), short(f(2).minutes), short(f(2).seconds), short(f(2).frames),
+        short(f(3).hours % 100), short(f(3).minutes), short(f(3).seconds), short(f(3).frames)
+    );
+
+    // (v * 6554) >> 16 == v / 10 for every v below 100
+    const __m256i tens = _mm256_mulhi_epu16(v, _mm256_set1_epi16(6554));
+    const __m256i units = _mm256_sub_epi16(v, _mm256_mullo_epi16(tens, _mm256_set1_epi16(10)));
+    const __m256i chars = _mm256_or_si256(_mm256_or_si256(tens, _mm256_slli_epi16(units, 8)),
+                                          _mm256_set1_epi16(0x3030));
+
+    const __m128i halves[2] = { _mm256_castsi256_si128(chars), _mm256_extracti128_si256(chars, 1) };
+    const __m128i gather[2] = {
+        _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5, -1, 6, 7, -1, -1, -1, -1, -1),
+        _mm_setr_epi8(8, 9, -1, 10, 11, -1, 12, 13, -1, 14, 15, -1, -1, -1, -1, -1)
+    };
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        const char fd = f(i).drop_frame ? ';' : ':';
+        const __m128i delims = _mm_setr_epi8(0, 0, ':', 0, 0, ':', 0, 0, fd, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i tc = _mm_or_si128(_mm_shuffle_epi8(halves[i / 2], gather[i % 2]), delims);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * VTM_TCSTRING_FIXED_SIZE), tc);
+    }
+
+    return out + 4 * VTM_TCSTRING_FIXED_SIZE;
+}
+
+#endif // @END OF VTM_TIMECODE_SIMD_AVX2
+
+} // @END OF namespace vtm::chrono::internal
+
+namespace vtm::chrono {
+
+// @SECTION: Writes exactly 11 bytes, no terminator. Hours are written modulo 100
+constexpr auto format_tcstring_fixed(char* out, const tcstring_fields& fields) noexcept -> char*
+{
+    const char fd = fields.drop_frame ? ';' : ':';
+    internal::write_digit_pair(out + 0, fields.hours);   out[2] = ':';
+    internal::write_digit_pair(out + 3, fields.minutes); out[5] = ':';
+    internal::write_digit_pair(out + 6, fields.seconds); out[8] = fd;
+    internal::write_digit_pair(out + 9, fields.frames);
+    return out + VTM_TCSTRING_FIXED_SIZE;
+}
+
+constexpr auto to_chars(char* first, char* last, const tcstring_fields& fields) noexcept -> std::to_chars_result
+{
+    if (last - first < VTM_TCSTRING_FIXED_SIZE) return { last, std::errc::value_too_large };
+    return { format_tcstring_fixed(first, fields), std::errc{} };
+}
+
+} // @END OF namespace vtm::chrono
+
+///////////////////////////////////////////////////////////////////////////
@@ -71,7 +71,7 @@ concept SequenceInvocable = requires (T&& t, Args&&... args) {
 };
 
 template<typename T>
-concept DefaultableEnum = magic_enum::is_unscoped_enum_v<T>
+concept DefaultableEnum = std::is_enum_v<T>
                        && requires (T t) {
                               T::none;
                           };
@@ -8,6 +8,8 @@
 // Standard library
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <concepts>
 #include <string>
@@ -34,8 +36,9 @@
 
 #define GET_ENUM_MAPPING_1(M, I) std::get<0>(M)(I)
 #define GET_ENUM_MAPPING_2(M, I) std::get<1>(M)(I)
-#define DECLARE_ENUM_MAPPING(T1, T2, ...) vtm::utility::internal::enum_map<T1, T2>(__VA_ARGS__)
-#define DECLARE_ENUM_MAPPING_BOOL(T1, T2, ...) vtm::utility::internal::enum_map<T1, T2>(__VA_ARGS__)
+// Mappings are constant variables, lookups read the tables in place instead of copying them per call
+#define DECLARE_ENUM_MAPPING(T1, T2, ...) vtm::utility::internal::enum_mapping_v<decltype([]() { return vtm::utility::internal::enum_map<T1, T2>(__VA_ARGS__); })>
+#define DECLARE_ENUM_MAPPING_BOOL(T1, T2, ...) DECLARE_ENUM_MAPPING(T1, T2, __VA_ARGS__)
 
 #endif // @END VTM_UTILITY_MACROS
 
@@ -126,6 +129,130 @@ consteval auto to_string_view(Callable callable) -> std::remove_cvref_t<TView>
     return view_t{static_data.begin(), static_data.end()};
 }
 
+// @SECTION: Seeded hash of a mapped value. Strings hash their length and the
+// two characters at the probe positions (clamped to the string), so a lookup
+// reads two bytes instead of the whole string. Floating point values hash their
+// double bit pattern with -0.0 folded into 0.0, equality is still exact
+template<typename T>
+constexpr auto enum_mapping_hash(const T& value, const std::uint64_t seed, const std::array<std::size_t, 2>& probes) noexcept -> std::uint64_t
+{
+    std::uint64_t h = seed;
+
+    if constexpr (std::convertible_to<const T&, std::string_view>) {
+        const std::string_view str(value);
+        h ^= str.size() * 0x9E3779B97F4A7C15ull;
+
+        if (!str.empty()) {
+            h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(str[std::min(probes[0], str.size() - 1)]));
+            h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(str[std::min(probes[1], str.size() - 1)])) << 8;
+        }
+    }
+
+    else if constexpr (std::floating_point<T>) {
+        h ^= std::bit_cast<std::uint64_t>(static_cast<double>(value) + 0.0);
+    }
+
+    else {
+        h ^= static_cast<std::uint64_t>(value);
+    }
+
+    // splitmix64 finalizer, the table only looks at the low bits
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+    return h ^ (h >> 31);
+}
+
+// @SECTION: Lookup tables for one enum mapping, built at compile time.
+// Enum to value indexes by the enum's offset when its values are contiguous.
+// Value to enum probes a single slot of a collision-free hash table, equal
+// values keep their first mapping like the linear scan they replace
+template<typename In, typename Out, std::size_t N, std::size_t M>
+struct enum_mapping_table
+{
+    static_assert(M > 0 && M <= N && M < 255, "enum mapping table holds between one and 254 values");
+    static constexpr std::size_t slot_count = std::bit_ceil(M * 4);
+
+    std::array<In, N> options{};
+    std::array<Out, M> values{};
+    std::array<std::uint8_t, slot_count> slots{};
+    std::array<std::size_t, 2> probes{};
+    std::uint64_t seed = 0;
+    bool dense = false;
+
+    // Index of in within options, N when in is not an enumerator
+    constexpr auto index_of(const In in) const noexcept -> std::size_t
+    {
+        if (dense) {
+            using underlying_t = std::underlying_type_t<In>;
+            const auto offset = static_cast<std::size_t>(static_cast<underlying_t>(in) - static_cast<underlying_t>(options[0]));
+            return offset < N ? offset : N;
+        }
+
+        for (std::size_t i = 0; i < N; ++i) {
+            if (options[i] == in) return i;
+        }
+
+        return N;
+    }
+
+    // Index of out within values, M when out is not mapped
+    constexpr auto find(const Out& out) const noexcept -> std::size_t
+    {
+        const std::size_t slot = slots[enum_mapping_hash(out, seed, probes) & (slot_count - 1)];
+        if (slot == 0 || !(values[slot - 1] == out)) return M;
+        return slot - 1;
+    }
+
+    // Fills slots for the current probes and seed, false on a collision
+    constexpr auto try_build() noexcept -> bool
+    {
+        slots = {};
+
+        for (std::size_t i = 0; i < M; ++i) {
+            bool duplicate = false;
+            for (std::size_t j = 0; j < i; ++j) duplicate = duplicate || values[j] == values[i];
+            if (duplicate) continue;
+
+            auto& slot = slots[enum_mapping_hash(values[i], seed, probes) & (slot_count - 1)];
+            if (slot != 0) return false;
+            slot = static_cast<std::uint8_t>(i + 1);
+        }
+
+        return true;
+    }
+};
+
+template<typename In, typename Out, std::size_t N, std::size_t M>
+consteval auto make_enum_mapping_table(const std::array<In, N>& options, const std::array<Out, M>& values)
+{
+    enum_mapping_table<In, Out, N, M> table{ options, values };
+
+    using underlying_t = std::underlying_type_t<In>;
+    table.dense = true;
+    for (std::size_t i = 0; i < N; ++i) {
+        table.dense = table.dense && static_cast<underlying_t>(options[i]) - static_cast<underlying_t>(options[0]) == static_cast<underlying_t>(i);
+    }
+
+    // Probe positions only matter for strings, search them up to the longest value
+    std::size_t probe_limit = 1;
+    if constexpr (std::convertible_to<const Out&, std::string_view>) {
+        for (const auto& value : values) probe_limit = std::max(probe_limit, std::string_view(value).size());
+    }
+
+    // Small tables, a collision-free seed turns up within a few tries
+    for (std::uint64_t seed = 0; seed < 64; ++seed) {
+        for (std::size_t p0 = 0; p0 < probe_limit; ++p0) {
+            for (std::size_t p1 = p0; p1 < probe_limit; ++p1) {
+                table.seed = seed;
+                table.probes = { p0, p1 };
+                if (table.try_build()) return table;
+            }
+        }
+    }
+
+    throw "no collision-free hash table for enum mapping values";
+}
+
 template<vtm::traits::DefaultableEnum In,
          std::semiregular Out,
          vtm::traits::SameAsReturn<Out>... Mappings>
@@ -135,26 +262,27 @@ inline consteval auto map_enum_values(std::invocable auto&& report_enum,
                                       Out&& default_out,
                                       Mappings&&... mappings)
 {
+    // Mappings follow the enumerators in order, skipping default_enum, which
+    // maps to and from default_out wherever it sits in the enum
     const auto options = magic_enum::enum_values<In>();
-    const std::array values{ std::forward<Out>(mappings())... };
+    const std::array mappings_out{ std::forward<Out>(mappings())... };
+    std::array<Out, magic_enum::enum_count<In>()> values{};
+    for (std::size_t i = 0, j = 0; i < values.size(); ++i) values[i] = options[i] == default_enum ? default_out : mappings_out[j++];
+
+    const auto table = make_enum_mapping_table(options, values);
+    constexpr std::size_t mapped = magic_enum::enum_count<In>();
 
     return std::make_tuple (
         [=](const In& in) {
-            std::size_t i = 0;
-            for (const auto& o : options) {
-                if (o == in) return values[i];
-                ++i;
-            }
-            report_enum();
+            const std::size_t i = table.index_of(in);
+            if (i < mapped) return table.values[i];
+            if (i == table.options.size()) report_enum();
             return default_out;
         },
 
         [=](const Out& in) {
-            std::size_t i = 0;
-            for (const auto& v : values) {
-                if (v == in) return options[i];
-                ++i;
-            }
+            const std::size_t i = table.find(in);
+            if (i < mapped) return table.options[i];
             report_out();
             return default_enum;
         }
@@ -176,6 +304,10 @@ consteval auto enum_map(std::invocable auto report_enum,
                                     [=]() { return Out{std::move(mappings)}; }...);
 }
 
+// @SECTION: One constant per DECLARE_ENUM_MAPPING expansion, Factory is a captureless lambda
+template<typename Factory>
+inline constexpr auto enum_mapping_v = Factory{}();
+
 } // @END OF namespace vtm::utility::internal
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,269 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "edlcache.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace {
+
+constexpr std::string_view avidpt_session_text =
+    "SESSION NAME:\tReel 1 Dialog\r\n"
+    "SAMPLE RATE:\t48000.000000\r\n"
+    "BIT DEPTH:\t24-bit\r\n"
+    "SESSION START TIMECODE:\t00:50:00;00\r\n"
+    "TIMECODE FORMAT:\t29.97 Drop Frame\r\n"
+    "# OF AUDIO TRACKS:\t2\r\n"
+    "# OF AUDIO CLIPS:\t3\r\n"
+    "# OF AUDIO FILES:\t2\r\n"
+    "\r\n"
+    "\r\n"
+    "T R A C K  L I S T I N G\r\n"
+    "TRACK NAME:\tDX 1\r\n"
+    "COMMENTS:\tboom\r\n"
+    "USER DELAY:\t12 Samples\r\n"
+    "STATE: \tInactive Muted\r\n"
+    "PLUG-INS: \t\r\n"
+    "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\r\n"
+    "1       \t1       \tdx_01-03                      \t01:00:00;00   \t01:00:05;00   \t00:00:05;00   \tUnmuted\r\n"
+    "1       \t2       \tdx 01 alt                     \t01:01:00;02   \t01:01:00;12   \t00:00:00;10   \tMuted\r\n"
+    "\r\n"
+    "\r\n"
+    "TRACK NAME:\tDX 2\r\n"
+    "COMMENTS:\t\r\n"
+    "USER DELAY:\t0 Samples\r\n"
+    "STATE: \t\r\n"
+    "PLUG-INS: \t\r\n"
+    "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\r\n"
+    "2       \t1       \tdx_01-03                      \t00:59:59;29.50\t01:00:00;01   \t00:00:00;01.50\tUnmuted\r\n"
+    "\r\n"
+    "\r\n";
+
+auto write_temp_file(const std::string_view name, const std::string_view text) -> std::string
+{
+    const auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return path;
+}
+
+auto temp_cache_dir(const std::string_view name) -> std::string
+{
+    const auto dir = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(dir);
+    return dir.string();
+}
+
+// Every field of the cache equals a fresh parse of path
+template<typename T>
+auto require_same_session(const vtm::avidpt_edl_cache& cache, const T& edl) -> void
+{
+    const auto& data = edl.data();
+    REQUIRE(cache.session_name() == data.session_name);
+    REQUIRE(cache.sample_rate() == data.sample_rate);
+    REQUIRE(cache.bit_depth() == data.bit_depth);
+    REQUIRE(cache.audio_clips() == data.audio_clips);
+    REQUIRE(cache.audio_files() == data.audio_files);
+    REQUIRE(cache.audio_tracks() == data.audio_tracks);
+    REQUIRE(cache.timecode_format() == data.timecode_format);
+    REQUIRE(cache.session_start() == data.session_start);
+    REQUIRE(cache.size() == data.tracks.size());
+
+    for (std::size_t t = 0; t < cache.size(); ++t) {
+        const auto& track = data.tracks[t].second;
+        const auto cached = cache[t];
+        REQUIRE(cached.name() == track.name);
+        REQUIRE(cached.comments() == track.comments);
+        REQUIRE(cached.delay() == track.delay.delay);
+        REQUIRE(cached.delay_unit() == track.delay.unit);
+        REQUIRE(cached.state() == track.state);
+        REQUIRE(cached.events().size() == track.events.size());
+
+        for (const auto& [e, event] : cached.events()) {
+            const auto& expected = track.events[e].second;
+            REQUIRE(event.id == expected.id);
+            REQUIRE(event.channel == expected.channel);
+            REQUIRE(event.name == expected.name);
+            REQUIRE(event.start_time == expected.start_time);
+            REQUIRE(event.end_time == expected.end_time);
+            REQUIRE(event.duration == expected.duration);
+            REQUIRE(event.state == expected.state);
+        }
+    }
+}
+
+} // @END OF namespace
+
+TEST_CASE("Avid PT EDL Cache Round Trip", "[EDL File][cache]")
+{
+    const auto path = write_temp_file("vtm_edlcache_session.txt", avidpt_session_text);
+    const auto dir = temp_cache_dir("vtm_edlcache_round_trip");
+    const auto source = vtm::edl::internal::avidpt_absolute_path(path);
+    const auto cache_path = vtm::edl::internal::avidpt_cache_path(path, dir);
+
+    vtm::avidpt_edl edl;
+    edl.parse_file(path);
+
+    // A cold open parses and writes the cache, a warm one only maps it
+    REQUIRE_FALSE(std::filesystem::exists(cache_path));
+    const auto cold = vtm::edl::open_cached(path, dir);
+    REQUIRE(cold.is_open());
+    REQUIRE(std::filesystem::exists(cache_path));
+    require_same_session(cold, edl);
+
+    const auto written = std::filesystem::last_write_time(cache_path);
+    const auto warm = vtm::edl::open_cached(path, dir);
+    REQUIRE(std::filesystem::last_write_time(cache_path) == written);
+    require_same_session(warm, edl);
+
+    // Columns span every track in order, clip names shared between tracks
+    // are stored once
+    REQUIRE(warm.event_count() == 3);
+    REQUIRE(warm.ids()[2] == 1);
+    REQUIRE(warm.channels()[2] == 2);
+    REQUIRE(warm[1].events().start_units().size() == 1);
+    REQUIRE(warm[1].events().start_units()[0] == warm.start_units()[2]);
+    REQUIRE(warm.event_name(0).data() == warm.event_name(2).data());
+    REQUIRE(warm[1].events().name(0) == "dx_01-03");
+    REQUIRE(warm[1].events().state(0) == "Unmuted");
+    REQUIRE_THROWS_AS(warm[2], std::out_of_range);
+
+    // Integer times keep their order and the subframe of 00:59:59;29.50
+    REQUIRE(warm.start_units()[0] < warm.start_units()[1]);
+    REQUIRE(warm.start_units()[2] < warm.start_units()[0]);
+    REQUIRE(warm.start_units()[2] % 100 == 50);
+    REQUIRE(warm.to_ticks(warm.to_units(warm.session_start())) == warm.session_start());
+
+    // Moved caches keep their views
+    vtm::avidpt_edl_cache moved = vtm::edl::open_cached(path, dir);
+    const std::string_view name = moved.session_name();
+    vtm::avidpt_edl_cache other = std::move(moved);
+    REQUIRE(other.session_name().data() == name.data());
+    REQUIRE_FALSE(moved.is_open());
+
+    vtm::avidpt_edl_cache direct;
+    REQUIRE(direct.open(cache_path, source));
+    REQUIRE(direct.open(cache_path, source, true));
+    REQUIRE_FALSE(direct.open(cache_path, path + ".other"));
+    REQUIRE_FALSE(direct.is_open());
+}
+
+TEST_CASE("Avid PT EDL Cache Invalidation", "[EDL File][cache]")
+{
+    const auto path = write_temp_file("vtm_edlcache_invalidation.txt", avidpt_session_text);
+    const auto dir = temp_cache_dir("vtm_edlcache_invalidation");
+    const auto source = vtm::edl::internal::avidpt_absolute_path(path);
+    const auto cache_path = vtm::edl::internal::avidpt_cache_path(path, dir);
+    (void)vtm::edl::open_cached(path, dir);
+
+    vtm::avidpt_edl_cache cache;
+    REQUIRE(cache.open(cache_path, source));
+
+    SECTION("Touched source with the same content")
+    {
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(5));
+        REQUIRE(cache.open(cache_path, source));
+    }
+
+    SECTION("Edited source of the same size")
+    {
+        std::string text(avidpt_session_text);
+        text.replace(text.find("Reel 1"), 6, "Reel 2");
+        write_temp_file("vtm_edlcache_invalidation.txt", text);
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(5));
+        REQUIRE_FALSE(cache.open(cache_path, source));
+
+        // Rebuilt on the next open
+        const auto rebuilt = vtm::edl::open_cached(path, dir);
+        REQUIRE(rebuilt.session_name() == "Reel 2 Dialog");
+        REQUIRE(cache.open(cache_path, source));
+    }
+
+    SECTION("Source of another size")
+    {
+        write_temp_file("vtm_edlcache_invalidation.txt", std::string(avidpt_session_text) + "\r\n");
+        REQUIRE_FALSE(cache.open(cache_path, source));
+    }
+
+    SECTION("Removed source")
+    {
+        std::filesystem::remove(path);
+        REQUIRE_FALSE(cache.open(cache_path, source));
+        REQUIRE_THROWS_AS(vtm::edl::open_cached(path, dir), std::runtime_error);
+    }
+
+    SECTION("Damaged cache files")
+    {
+        std::string bytes;
+        {
+            std::ifstream in(cache_path, std::ios::binary);
+            bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        cache.close();
+
+        const auto damaged = [&](const std::string& copy) {
+            std::ofstream(cache_path, std::ios::binary | std::ios::trunc) << copy;
+            return !cache.open(cache_path, source);
+        };
+
+        std::string version = bytes;
+        version[8] = char(vtm::edl::internal::avidpt_cache_version + 1);
+        REQUIRE(damaged(version));
+        REQUIRE(damaged(bytes.substr(0, bytes.size() - 1)));
+        REQUIRE(damaged(bytes.substr(0, 100)));
+        REQUIRE(damaged(std::string()));
+
+        std::string tracks = bytes;
+        tracks[offsetof(vtm::edl::internal::__AvidPTCacheHeader, track_count)] = 100;
+        REQUIRE(damaged(tracks));
+
+        // Replaced by a valid cache on the next open
+        REQUIRE(vtm::edl::open_cached(path, dir).session_name() == "Reel 1 Dialog");
+    }
+
+    REQUIRE_FALSE(cache_path.empty());
+    REQUIRE(vtm::edl::internal::avidpt_cache_path(path, dir) == cache_path);
+}
+
+TEST_CASE("Avid PT EDL Cache Frame Rates", "[EDL File][cache]")
+{
+    // Parsed ticks survive the integer units exactly at every rate, with and
+    // without subframes
+    for (const auto fps : { vtm::fps::fps_25, vtm::fps::fps_23p976, vtm::fps::fpsdf_29p97, vtm::fps::fps_29p97, vtm::fps::fpsdf_59p94, vtm::fps::none }) {
+        INFO("fps: " << vtm::fps::to_string(fps));
+        const bool samples = fps == vtm::fps::none;
+        const auto format = vtm::edl::internal::__AvidPTTimeFormat<vtm::chrono::float64_t>::from_session(fps, 48000);
+
+        std::string text = "SESSION NAME:\tRates\nSAMPLE RATE:\t48000.000000\nBIT DEPTH:\t24-bit\n";
+        if (!samples) text += "SESSION START TIMECODE:\t00:50:00" + std::string(vtm::fps::is_drop_frame(fps) ? ";" : ":") + "00\n";
+        text += "TIMECODE FORMAT:\t" + std::string(__AVIDPTEDL_FPS_TO_STRING(fps)) + "\n";
+        text += "# OF AUDIO TRACKS:\t1\n\n\nT R A C K  L I S T I N G\n";
+        text += "TRACK NAME:\tA\nCOMMENTS:\t\nUSER DELAY:\t3 Frames\nSTATE: \tHidden Solo\nPLUG-INS: \t\n";
+        text += "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+
+        for (std::uint32_t e = 0; e < 3000; ++e) {
+            const vtm::chrono::float64_t ticks = samples ? vtm::chrono::float64_t(e * 1001) / 48000 / 100
+                                                         : vtm::chrono::float64_t(e * 7 + 100000) * format.coefs[3];
+            char label[32];
+            std::string start(label, format.format_to(label, ticks));
+            if (!samples) start.resize(VTM_TCSTRING_FIXED_SIZE);
+            if (!samples && e % 3 == 0) start += e % 9 == 0 ? ".50" : ".07";
+            text += "1       \t" + std::to_string(e + 1) + "\tclip " + std::to_string(e % 10) + "\t" + start + "\t" + start + "\t" + start + "\tUnmuted\n";
+        }
+        text += "\n\n";
+
+        const auto path = write_temp_file("vtm_edlcache_rates.txt", text);
+        const auto dir = temp_cache_dir("vtm_edlcache_rates");
+        vtm::avidpt_edl edl;
+        edl.parse_file(path);
+
+        const auto cache = vtm::edl::open_cached(path, dir);
+        REQUIRE(cache.event_count() == 3000);
+        require_same_session(cache, edl);
+    }
+}
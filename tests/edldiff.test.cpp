@@ -0,0 +1,182 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "edldiff.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct clip
+{
+    std::string track;
+    std::string name;
+    int start = 0; // Frames at 25 fps
+    int end = 0;
+};
+
+auto make_session(const std::vector<std::string>& tracks, const std::vector<clip>& clips) -> std::string
+{
+    const auto tc = [](const int frames) {
+        return fmt::format("{:02}:{:02}:{:02}:{:02}", frames / 90000, frames / 1500 % 60, frames / 25 % 60, frames % 25);
+    };
+
+    std::string text = "SESSION NAME:\tDiff\nSAMPLE RATE:\t48000.000000\nTIMECODE FORMAT:\t25 Frame\n\n\nT R A C K  L I S T I N G\n";
+    for (const auto& track : tracks) {
+        text += "TRACK NAME:\t" + track + "\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n";
+        text += "CHANNEL \tEVENT   \tCLIP NAME\tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+        int id = 0;
+        for (const auto& c : clips) {
+            if (c.track != track) continue;
+            text += fmt::format("1\t{}\t{}\t{}\t{}\t{}\tUnmuted\n", ++id, c.name, tc(c.start), tc(c.end), tc(c.end - c.start));
+        }
+        text += "\n\n";
+    }
+
+    return text;
+}
+
+auto write_temp_file(const std::string_view name, const std::string& text) -> std::string
+{
+    const auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+    return path;
+}
+
+} // @END OF namespace
+
+TEMPLATE_TEST_CASE("Avid PT EDL Diff", "[EDL File][diff]", vtm::avidpt_edl, vtm::avidpt_edl_columnar)
+{
+    using kind = vtm::edl::event_change_kind;
+    constexpr int hour = 90000;
+
+    const std::vector<clip> before = {
+        { "DX 1", "dx_01", hour,        hour + 125 },
+        { "DX 1", "dx_02", hour + 200,  hour + 300 },
+        { "DX 1", "dx_03", hour + 400,  hour + 500 },
+        { "DX 1", "dx_04", hour + 600,  hour + 700 },
+        { "DX 1", "tone",  hour + 800,  hour + 850 },
+        { "DX 1", "tone",  hour + 900,  hour + 950 },
+        { "DX 2", "dx_09", hour,        hour + 50 },
+        { "FX",   "door",  hour,        hour + 10 },
+        { "FX",   "door",  hour + 100,  hour + 110 },
+    };
+    const std::vector<clip> after = {
+        { "DX 1", "dx_01", hour,        hour + 125 }, // Unchanged
+        { "DX 1", "dx_02", hour + 250,  hour + 350 }, // Moved 2 seconds later
+        { "DX 1", "dx_03", hour + 400,  hour + 480 }, // Tail trimmed
+        { "DX 1", "dx_05", hour + 600,  hour + 700 }, // Replaces dx_04
+        { "DX 1", "tone",  hour + 800,  hour + 850 }, // Unchanged
+        { "DX 1", "tone",  hour + 1000, hour + 1050 }, // Second tone moved
+        { "FX",   "door",  hour,        hour + 10 },
+        { "FX",   "door",  hour + 100,  hour + 110 },
+        { "MX",   "cue_1", hour,        hour + 1000 },
+    };
+
+    TestType a;
+    TestType b;
+    a.parse_file(write_temp_file("vtm_edldiff_a.txt", make_session({ "DX 1", "DX 2", "FX" }, before)));
+    b.parse_file(write_temp_file("vtm_edldiff_b.txt", make_session({ "MX", "FX", "DX 1" }, after)));
+    const auto diff = vtm::edl::diff(a, b);
+
+    // Tracks by name, in b order
+    REQUIRE(diff.tracks == std::vector<std::pair<std::size_t, std::size_t>>{ { 2, 1 }, { 0, 2 } });
+    REQUIRE(diff.inserted_tracks == std::vector<std::size_t>{ 0 });
+    REQUIRE(diff.deleted_tracks == std::vector<std::size_t>{ 1 });
+    REQUIRE(diff.unchanged == 4);
+    REQUIRE(diff.count(kind::moved) == 2);
+    REQUIRE(diff.count(kind::trimmed) == 1);
+    REQUIRE(diff.count(kind::inserted) == 2);
+    REQUIRE(diff.count(kind::deleted) == 2);
+    REQUIRE(diff.changes.size() == 7);
+
+    // DX 1 changes in timeline order
+    const auto& c = diff.changes;
+    REQUIRE(c[0].kind == kind::moved);
+    REQUIRE(c[0].track_a == 0);
+    REQUIRE(c[0].event_a == 1);
+    REQUIRE(c[0].track_b == 2);
+    REQUIRE(c[0].event_b == 1);
+    REQUIRE(c[0].start_delta == b[2].events[1].second.start_time - a[0].events[1].second.start_time);
+    REQUIRE(c[0].end_delta == Catch::Approx(c[0].start_delta));
+
+    REQUIRE(c[1].kind == kind::trimmed);
+    REQUIRE(c[1].event_a == 2);
+    REQUIRE(c[1].start_delta == 0.0);
+    REQUIRE(c[1].end_delta < 0.0);
+
+    // A renamed clip is a deletion and an insertion
+    REQUIRE(c[2].kind == kind::inserted);
+    REQUIRE(c[2].event_b == 3);
+    REQUIRE(c[2].track_a == vtm::avidpt_edl_diff::change_t::npos);
+    REQUIRE(c[3].kind == kind::deleted);
+    REQUIRE(c[3].event_a == 3);
+    REQUIRE(c[3].position == c[2].position);
+
+    REQUIRE(c[4].kind == kind::moved);
+    REQUIRE(c[4].event_a == 5);
+    REQUIRE(c[4].event_b == 5);
+
+    // Events of whole tracks, inserted then deleted
+    REQUIRE(c[5].kind == kind::inserted);
+    REQUIRE(c[5].track_b == 0);
+    REQUIRE(c[6].kind == kind::deleted);
+    REQUIRE(c[6].track_a == 1);
+    REQUIRE(c[6].track_b == vtm::avidpt_edl_diff::change_t::npos);
+
+    // A session against itself
+    const auto same = vtm::edl::diff(a, a);
+    REQUIRE(same.empty());
+    REQUIRE(same.unchanged == before.size());
+    REQUIRE(same.tracks.size() == 3);
+}
+
+TEST_CASE("Avid PT EDL Diff Generated Edits", "[EDL File][diff]")
+{
+    using kind = vtm::edl::event_change_kind;
+
+    // 4 tracks of 500 clips, every fifth clip edited one of four ways
+    std::vector<clip> before;
+    std::vector<clip> after;
+    std::map<kind, std::size_t> expected;
+    for (int t = 0; t < 4; ++t) {
+        const std::string track = "Track " + std::to_string(t);
+        for (int e = 0; e < 500; ++e) {
+            const clip original{ track, fmt::format("clip_{}_{}", t, e), 90000 + e * 100, 90000 + e * 100 + 40 };
+            before.push_back(original);
+
+            clip edited = original;
+            switch (e % 20) {
+                case 5:  edited.start += 50; edited.end += 50; ++expected[kind::moved]; break;
+                case 10: edited.end -= 1; ++expected[kind::trimmed]; break;
+                case 15: edited.name += "_alt"; ++expected[kind::inserted]; ++expected[kind::deleted]; break;
+                case 0:  ++expected[kind::deleted]; continue;
+                default: break;
+            }
+            after.push_back(edited);
+        }
+    }
+
+    const std::vector<std::string> tracks = { "Track 0", "Track 1", "Track 2", "Track 3" };
+    vtm::avidpt_edl a;
+    vtm::avidpt_edl b;
+    a.parse_file(write_temp_file("vtm_edldiff_generated_a.txt", make_session(tracks, before)));
+    b.parse_file(write_temp_file("vtm_edldiff_generated_b.txt", make_session(tracks, after)));
+    const auto diff = vtm::edl::diff(a, b);
+
+    for (const kind k : { kind::inserted, kind::deleted, kind::moved, kind::trimmed }) REQUIRE(diff.count(k) == expected[k]);
+    REQUIRE(diff.unchanged == 2000 - expected[kind::moved] - expected[kind::trimmed] - expected[kind::deleted]);
+
+    // Every change points at the events it names
+    for (const auto& change : diff.changes) {
+        if (change.kind != kind::inserted) REQUIRE(change.event_a < a[change.track_a].events.size());
+        if (change.kind != kind::deleted) REQUIRE(change.event_b < b[change.track_b].events.size());
+        if (change.kind == kind::moved || change.kind == kind::trimmed) {
+            REQUIRE(a[change.track_a].events[change.event_a].second.name == b[change.track_b].events[change.event_b].second.name);
+        }
+    }
+}
@@ -1,6 +1,18 @@
 #define CATCH_CONFIG_MAIN
 #include <Catch2/catch_all.hpp>
 #include "edlfile.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 TEST_CASE("EDL File Initialization", "[EDL File]")
 {
@@ -18,3 +30,918 @@ TEST_CASE("EDL File Initialization", "[EDL File]")
     /* REQUIRE(std::string{edl_file}        == "EDL File Empty"); */
     /* REQUIRE(std::string_view{ edl_file } == "EDL File Empty"); */
 }
+
+namespace {
+
+constexpr std::string_view avidpt_session_text =
+    "SESSION NAME:\tReel 1 Dialog\r\n"
+    "SAMPLE RATE:\t48000.000000\r\n"
+    "BIT DEPTH:\t24-bit\r\n"
+    "SESSION START TIMECODE:\t00:50:00;00\r\n"
+    "TIMECODE FORMAT:\t29.97 Drop Frame\r\n"
+    "# OF AUDIO TRACKS:\t2\r\n"
+    "# OF AUDIO CLIPS:\t3\r\n"
+    "# OF AUDIO FILES:\t2\r\n"
+    "\r\n"
+    "\r\n"
+    "O N L I N E  F I L E S  I N  S E S S I O N\r\n"
+    "Filename\tLocation\r\n"
+    "dx_01.wav\tAudio Files:\r\n"
+    "\r\n"
+    "\r\n"
+    "T R A C K  L I S T I N G\r\n"
+    "TRACK NAME:\tDX 1\r\n"
+    "COMMENTS:\tboom\r\n"
+    "USER DELAY:\t12 Samples\r\n"
+    "STATE: \tInactive Muted\r\n"
+    "PLUG-INS: \t\r\n"
+    "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\r\n"
+    "1       \t1       \tdx_01-03                      \t01:00:00;00   \t01:00:05;00   \t00:00:05;00   \tUnmuted\r\n"
+    "1       \t2       \tdx 01 alt                     \t01:01:00;02   \t01:01:00;12   \t00:00:00;10   \tMuted\r\n"
+    "\r\n"
+    "\r\n"
+    "TRACK NAME:\tDX 2\r\n"
+    "COMMENTS:\t\r\n"
+    "USER DELAY:\t0 Samples\r\n"
+    "STATE: \t\r\n"
+    "PLUG-INS: \t\r\n"
+    "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\r\n"
+    "2       \t1       \troom tone                     \t00:59:59;29.50\t01:00:00;01   \t00:00:00;01.50\tUnmuted\r\n"
+    "\r\n"
+    "\r\n"
+    "M A R K E R S  L I S T I N G\r\n"
+    "#   \tLOCATION     \tTIME REFERENCE    \tUNITS    \tNAME                             \tCOMMENTS\r\n"
+    "1   \t01:00:00;00  \t172627           \tSamples  \tFFOA                             \t\r\n";
+
+auto write_temp_file(const std::string_view name, const std::string_view text) -> std::string
+{
+    const auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return path;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Avid PT EDL Parsing", "[EDL File][parse]", vtm::avidpt_edl, vtm::avidpt_edl_view, vtm::avidpt_edl_arena)
+{
+    const auto path = write_temp_file("vtm_edlfile_parse.txt", avidpt_session_text);
+    const auto tc = [](std::string_view s) { return vtm::f64timecode::from_string(s, vtm::fps::fpsdf_29p97).as_float(); };
+
+    TestType edl;
+    edl.parse_file(path);
+    const auto& data = edl.data();
+
+    // @SECTION Session header
+    REQUIRE(data.session_name == "Reel 1 Dialog");
+    REQUIRE(data.sample_rate == 48000);
+    REQUIRE(data.bit_depth == 24);
+    REQUIRE(data.audio_tracks == 2);
+    REQUIRE(data.audio_clips == 3);
+    REQUIRE(data.audio_files == 2);
+    REQUIRE(data.timecode_format == vtm::fps::fpsdf_29p97);
+    REQUIRE(data.session_start == tc("00:50:00;00"));
+
+    // @SECTION Tracks
+    REQUIRE(data.tracks.size() == 2);
+    const auto& dx1 = data.tracks[0].second;
+    REQUIRE(dx1.name == "DX 1");
+    REQUIRE(dx1.comments == "boom");
+    REQUIRE(dx1.delay.delay == 12);
+    REQUIRE(dx1.delay.unit == vtm::edl::internal::TimelineUnitFormat::samples);
+    REQUIRE(dx1.state == (std::uint64_t(vtm::edl::internal::__AvidPTTrackState::inactive) |
+                          std::uint64_t(vtm::edl::internal::__AvidPTTrackState::muted)));
+
+    // @SECTION Events
+    REQUIRE(dx1.events.size() == 2);
+    const auto& e1 = dx1.events[0].second;
+    REQUIRE(e1.channel == 1);
+    REQUIRE(e1.id == 1);
+    REQUIRE(e1.name == "dx_01-03");
+    REQUIRE(e1.start_time == tc("01:00:00;00"));
+    REQUIRE(e1.end_time == tc("01:00:05;00"));
+    REQUIRE(e1.duration == tc("00:00:05;00"));
+    REQUIRE(e1.state == "Unmuted");
+    REQUIRE(dx1.events[1].second.name == "dx 01 alt");
+    REQUIRE(dx1.events[1].second.start_time == tc("01:01:00;02"));
+
+    const auto& dx2 = data.tracks[1].second;
+    REQUIRE(dx2.name == "DX 2");
+    REQUIRE(dx2.comments == "");
+    REQUIRE(dx2.state == 0);
+    REQUIRE(dx2.events.size() == 1);
+    REQUIRE(dx2.events[0].second.channel == 2);
+    REQUIRE(dx2.events[0].second.start_time == Catch::Approx(tc("00:59:59;29") + tc("00:00:00;01") / 2));
+
+    edl.clear();
+    REQUIRE(edl.data().tracks.empty());
+    REQUIRE(edl.data().session_name == "");
+}
+
+TEST_CASE("Avid PT EDL Parse Errors", "[EDL File][parse]")
+{
+    vtm::avidpt_edl edl;
+    REQUIRE_THROWS_AS(edl.parse_file("./resources/txt/foo.txt"), std::runtime_error);
+
+    const auto bad_tc = write_temp_file("vtm_edlfile_bad_tc.txt",
+        "TIMECODE FORMAT:\t25 Frame\n"
+        "T R A C K  L I S T I N G\n"
+        "TRACK NAME:\tA\n"
+        "CHANNEL\tEVENT\tCLIP NAME\tSTART TIME\tEND TIME\tDURATION\tSTATE\n"
+        "1\t1\tclip\t01:00:0x:00\t01:00:01:00\t00:00:01:00\tUnmuted\n");
+    edl.parse_file(bad_tc);
+    REQUIRE_THROWS_AS(edl.tracks(), std::runtime_error);
+    REQUIRE_FALSE(edl.is_parsed(vtm::edl::internal::__AvidPTEDLSection::track_listing));
+    REQUIRE(edl.session().tracks.empty());
+
+    // Sessions exported in samples convert through the sample rate
+    const auto samples = write_temp_file("vtm_edlfile_samples.txt",
+        "SAMPLE RATE:\t48000.000000\n"
+        "T R A C K  L I S T I N G\n"
+        "TRACK NAME:\tA\n"
+        "CHANNEL\tEVENT\tCLIP NAME\tSTART TIME\tEND TIME\tDURATION\tSTATE\n"
+        "1\t1\tclip\t48000\t96000\t48000\tUnmuted\n");
+    edl.parse_file(samples);
+    REQUIRE(edl.tracks().size() == 1);
+    REQUIRE(edl.data().tracks[0].second.events[0].second.start_time == Catch::Approx(0.01));
+    REQUIRE(edl.data().tracks[0].second.events[0].second.end_time == Catch::Approx(0.02));
+}
+
+TEST_CASE("Avid PT EDL Section Index", "[EDL File][parse][index]")
+{
+    using section = vtm::edl::internal::__AvidPTEDLSection;
+    using index_t = vtm::edl::internal::__AvidPTEDLSectionIndex;
+
+    const auto index = index_t::build(avidpt_session_text);
+    REQUIRE(index.contains(section::header));
+    REQUIRE(index.contains(section::online_files));
+    REQUIRE(index.contains(section::track_listing));
+    REQUIRE(index.contains(section::markers_listing));
+    REQUIRE_FALSE(index.contains(section::plugin_listing));
+    REQUIRE_FALSE(index.contains(section::none));
+
+    REQUIRE(index.text(avidpt_session_text, section::header).starts_with("SESSION NAME:"));
+    REQUIRE(index.text(avidpt_session_text, section::header).ends_with("\r\n\r\n\r\n"));
+    REQUIRE(index.text(avidpt_session_text, section::online_files).starts_with("Filename\tLocation"));
+    REQUIRE(index.text(avidpt_session_text, section::track_listing).starts_with("TRACK NAME:\tDX 1"));
+    REQUIRE(index.text(avidpt_session_text, section::markers_listing).starts_with("#   \tLOCATION"));
+    REQUIRE(index.text(avidpt_session_text, section::plugin_listing).empty());
+    REQUIRE(index.range(section::track_listing).line == 17);
+    REQUIRE(index.range(section::markers_listing).line == 37);
+
+    // Banners at every offset of a SIMD block, behind lines that look like banners
+    for (std::size_t pad = 0; pad < 40; ++pad) {
+        std::string text = "SESSION NAME:\tpad\n";
+        text += "A B is not a banner\n";
+        text += std::string(pad, 'x') + "\n";
+        text += "T R A C K  L I S T I N G\n";
+        text += "TRACK NAME:\tA\n";
+
+        const auto padded = index_t::build(text);
+        INFO("pad: " << pad);
+        REQUIRE(padded.contains(section::track_listing));
+        REQUIRE(padded.range(section::track_listing).line == 5);
+        REQUIRE(padded.text(text, section::track_listing) == "TRACK NAME:\tA\n");
+        REQUIRE(padded.range(section::header).end == text.find("T R A C K"));
+    }
+}
+
+TEST_CASE("Avid PT EDL Lazy Sections", "[EDL File][parse][index]")
+{
+    using section = vtm::edl::internal::__AvidPTEDLSection;
+    const auto path = write_temp_file("vtm_edlfile_lazy.txt", avidpt_session_text);
+
+    vtm::avidpt_edl edl;
+    edl.parse_file(path);
+
+    // Only the header is parsed up front
+    REQUIRE(edl.is_parsed(section::header));
+    REQUIRE_FALSE(edl.is_parsed(section::track_listing));
+    REQUIRE(edl.session().session_name == "Reel 1 Dialog");
+    REQUIRE(edl.session().tracks.empty());
+    REQUIRE(edl.has_section(section::markers_listing));
+    REQUIRE(edl.section_text(section::markers_listing).find("FFOA") != std::string_view::npos);
+
+    REQUIRE(edl.tracks().size() == 2);
+    REQUIRE(edl.is_parsed(section::track_listing));
+    REQUIRE(edl.tracks()[1].second.name == "DX 2");
+
+    edl.clear();
+    REQUIRE_FALSE(edl.is_parsed(section::header));
+    REQUIRE_FALSE(edl.has_section(section::track_listing));
+    REQUIRE(edl.section_text(section::track_listing).empty());
+}
+
+TEST_CASE("Avid PT EDL Parallel Track Parsing", "[EDL File][parse][parallel]")
+{
+    std::string text = "SESSION NAME:\tParallel\nSAMPLE RATE:\t48000.000000\nTIMECODE FORMAT:\t25 Frame\n\n\nT R A C K  L I S T I N G\n";
+    for (int t = 0; t < 300; ++t) {
+        text += "TRACK NAME:\tTrack " + std::to_string(t) + "\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n";
+        text += "CHANNEL \tEVENT   \tCLIP NAME\tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+        for (int e = 0; e < t % 7; ++e) {
+            text += "1\t" + std::to_string(e + 1) + "\tclip " + std::to_string(t) + "\t01:00:0" + std::to_string(e) + ":00\t01:00:0" + std::to_string(e + 1) + ":00\t00:00:01:00\tUnmuted\n";
+        }
+        text += "\n\n";
+    }
+
+    const auto path = write_temp_file("vtm_edlfile_parallel.txt", text);
+    vtm::utility::thread_pool pool(3);
+
+    vtm::avidpt_edl serial;
+    vtm::avidpt_edl parallel;
+    serial.parse_file(path);
+    parallel.set_thread_pool(&pool);
+    parallel.parse_file(path);
+
+    // Same tracks in file order, whichever worker parsed them
+    const auto& expected = serial.tracks();
+    const auto& actual = parallel.tracks();
+    REQUIRE(actual.size() == 300);
+    REQUIRE(actual.size() == expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i) {
+        INFO("track: " << i);
+        REQUIRE(actual[i].first == i);
+        REQUIRE(actual[i].second.name == expected[i].second.name);
+        REQUIRE(actual[i].second.events.size() == expected[i].second.events.size());
+        for (std::size_t e = 0; e < actual[i].second.events.size(); ++e) {
+            REQUIRE(actual[i].second.events[e].second.name == expected[i].second.events[e].second.name);
+            REQUIRE(actual[i].second.events[e].second.start_time == expected[i].second.events[e].second.start_time);
+        }
+    }
+
+    // Errors in any block reach the caller with their line number
+    text += "TRACK NAME:\tBroken\nCHANNEL\tEVENT\tCLIP NAME\tSTART TIME\tEND TIME\tDURATION\tSTATE\n1\t1\tclip\tnot a time\t01:00:01:00\t00:00:01:00\tUnmuted\n";
+    const auto broken = write_temp_file("vtm_edlfile_parallel_broken.txt", text);
+    parallel.parse_file(broken);
+    const auto broken_line = std::count(text.begin(), text.end(), '\n');
+    REQUIRE_THROWS_WITH(parallel.tracks(), Catch::Matchers::StartsWith("line " + std::to_string(broken_line) + ":"));
+}
+
+TEST_CASE("Avid PT EDL String Arena", "[EDL File][parse][arena]")
+{
+    const auto path = write_temp_file("vtm_edlfile_arena.txt", avidpt_session_text);
+
+    vtm::avidpt_edl_arena edl;
+    edl.parse_file(path);
+    const auto& data = edl.data();
+
+    // Strings live in the arena, not in the mapped file
+    const auto source = edl.section_text(vtm::edl::internal::__AvidPTEDLSection::header);
+    REQUIRE(data.session_name == "Reel 1 Dialog");
+    REQUIRE((data.session_name.data() < source.data() || data.session_name.data() >= source.data() + avidpt_session_text.size()));
+
+    // Equal strings are stored once
+    const auto& e1 = data.tracks[0].second.events[0].second;
+    const auto& e3 = data.tracks[1].second.events[0].second;
+    REQUIRE(e1.state == "Unmuted");
+    REQUIRE(e1.state.data() == e3.state.data());
+    REQUIRE(data.strings.size() == 9);
+
+    edl.clear();
+    REQUIRE(edl.session().strings.size() == 0);
+    REQUIRE(edl.session().strings.bytes() == 0);
+}
+
+TEST_CASE("Avid PT EDL Columnar Events", "[EDL File][parse][columnar]")
+{
+    const auto path = write_temp_file("vtm_edlfile_columnar.txt", avidpt_session_text);
+    const auto tc = [](std::string_view s) { return vtm::f64timecode::from_string(s, vtm::fps::fpsdf_29p97).as_float(); };
+
+    vtm::avidpt_edl rows;
+    vtm::avidpt_edl_columnar columns;
+    rows.parse_file(path);
+    columns.parse_file(path);
+
+    // Rows read back match the row oriented parse, timecodes narrowed to double
+    const auto& expected = rows.tracks();
+    const auto& actual = columns.tracks();
+    REQUIRE(actual.size() == expected.size());
+    for (std::size_t t = 0; t < actual.size(); ++t) {
+        const auto& events = actual[t].second.events;
+        REQUIRE(actual[t].second.name == expected[t].second.name);
+        REQUIRE(events.size() == expected[t].second.events.size());
+
+        std::size_t e = 0;
+        for (const auto& [i, event] : events) {
+            const auto& other = expected[t].second.events[e].second;
+            REQUIRE(i == e++);
+            REQUIRE(event.id == other.id);
+            REQUIRE(event.channel == other.channel);
+            REQUIRE(event.name == other.name);
+            REQUIRE(event.state == other.state);
+            REQUIRE(event.start_time == Catch::Approx(other.start_time));
+            REQUIRE(event.end_time == Catch::Approx(other.end_time));
+            REQUIRE(event.duration == Catch::Approx(other.duration));
+        }
+    }
+
+    // Strings are copied into the track heap
+    const auto& dx1 = actual[0].second.events;
+    REQUIRE(dx1.heap() == "dx_01-03Unmuteddx 01 altMuted");
+    REQUIRE(dx1.name(1) == "dx 01 alt");
+    REQUIRE(dx1.state(1) == "Muted");
+
+    // Column scans
+    REQUIRE(dx1.ids()[1] == 2);
+    REQUIRE(dx1.extent().first == Catch::Approx(tc("01:00:00;00")));
+    REQUIRE(dx1.total_duration() == Catch::Approx(dx1[0].second.duration + dx1[1].second.duration));
+
+    std::vector<std::size_t> hits;
+    dx1.overlapping(tc("01:00:04;00"), tc("01:00:30;00"), hits);
+    REQUIRE(hits == std::vector<std::size_t>{ 0 });
+
+    columns.clear();
+    REQUIRE(columns.data().tracks.empty());
+
+    // A state repeated from the previous row is stored once
+    vtm::edl::internal::__AvidPTEventStore<> store;
+    vtm::edl::internal::__AvidPTEventStore<>::event_t event;
+    event.name = "a";
+    event.state = "Unmuted";
+    store.push_back(event);
+    event.name = "b";
+    store.push_back(event);
+    REQUIRE(store.heap() == "aUnmutedb");
+    REQUIRE(store.state(1) == "Unmuted");
+}
+
+TEMPLATE_TEST_CASE("Avid PT EDL Name Lookup", "[EDL File][parse][index]", vtm::avidpt_edl, vtm::avidpt_edl_columnar)
+{
+    const auto path = write_temp_file("vtm_edlfile_lookup.txt", avidpt_session_text);
+
+    TestType edl;
+    edl.parse_file(path);
+
+    // The first lookup parses the track listing
+    REQUIRE(edl.find_tracks("DX 2").size() == 1);
+    REQUIRE(edl.is_parsed(vtm::edl::internal::__AvidPTEDLSection::track_listing));
+    REQUIRE(edl.find_tracks("DX 2")[0] == 1);
+    REQUIRE(edl.get_track("DX 1").comments == "boom");
+    REQUIRE(&edl.get_track("DX 1") == &edl[0]);
+    REQUIRE(edl.find_tracks("DX 3").empty());
+    REQUIRE_THROWS_AS(edl.get_track("DX 3"), std::out_of_range);
+    REQUIRE_THROWS_AS(edl[2], std::out_of_range);
+
+    using ref = vtm::edl::internal::__AvidPTEventRef;
+    REQUIRE(std::ranges::equal(edl.find_events("room tone"), std::vector<ref>{ { 1, 0 } }));
+    REQUIRE(edl.get_event("dx 01 alt").id == 2);
+    REQUIRE(edl.find_events("dx").empty());
+    REQUIRE_THROWS_AS(edl.get_event("dx"), std::out_of_range);
+
+    // Every match of a repeated name, in file order
+    std::string text = "SESSION NAME:\tLookup\nSAMPLE RATE:\t48000.000000\nTIMECODE FORMAT:\t25 Frame\n\n\nT R A C K  L I S T I N G\n";
+    for (int t = 0; t < 50; ++t) {
+        text += "TRACK NAME:\t" + std::string(t % 2 ? "Odd" : "Track " + std::to_string(t)) + "\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n";
+        text += "CHANNEL \tEVENT   \tCLIP NAME\tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+        for (int e = 0; e < 20; ++e) {
+            text += "1\t" + std::to_string(e + 1) + "\tclip " + std::to_string(e % 10) + "\t01:00:00:00\t01:00:01:00\t00:00:01:00\tUnmuted\n";
+        }
+        text += "\n\n";
+    }
+
+    edl.parse_file(write_temp_file("vtm_edlfile_lookup_repeated.txt", text));
+    REQUIRE(edl.find_tracks("DX 1").empty());
+    REQUIRE(edl.find_tracks("Track 48").size() == 1);
+
+    const auto odd = edl.find_tracks("Odd");
+    REQUIRE(odd.size() == 25);
+    for (std::size_t i = 0; i < odd.size(); ++i) REQUIRE(odd[i] == 2 * i + 1);
+
+    const auto clips = edl.find_events("clip 3");
+    REQUIRE(clips.size() == 100);
+    for (std::size_t i = 0; i < clips.size(); ++i) {
+        REQUIRE(clips[i] == ref{ i / 2, 3 + (i % 2) * 10 });
+        REQUIRE(edl.tracks()[clips[i].track].second.events[clips[i].event].second.name == "clip 3");
+    }
+
+    edl.clear();
+    REQUIRE(edl.find_events("clip 3").empty());
+}
+
+TEMPLATE_TEST_CASE("Avid PT EDL Time Range Queries", "[EDL File][parse][index]", vtm::avidpt_edl, vtm::avidpt_edl_columnar)
+{
+    using ref = vtm::edl::internal::__AvidPTEventRef;
+    const auto tc = [](std::string_view s) { return vtm::f64timecode::from_string(s, vtm::fps::fpsdf_29p97).as_float(); };
+
+    TestType edl;
+    edl.parse_file(write_temp_file("vtm_edlfile_ranges.txt", avidpt_session_text));
+
+    // Events starting in the range come in start time order
+    REQUIRE(edl.events_in_range(tc("00:59:59;29"), tc("01:00:00;01")) == std::vector<ref>{ { 1, 0 }, { 0, 0 } });
+    REQUIRE(edl.events_in_range(tc("01:00:01;00"), tc("01:00:02;00")) == std::vector<ref>{ { 0, 0 } });
+    REQUIRE(edl.is_parsed(vtm::edl::internal::__AvidPTEDLSection::track_listing));
+    REQUIRE(edl.events_in_range(tc("01:00:04;00"), tc("01:00:30;00")) == std::vector<ref>{ { 0, 0 } });
+    REQUIRE(edl.events_in_range(tc("01:00:59;00"), tc("02:00:00;00")) == std::vector<ref>{ { 0, 1 } });
+    REQUIRE(edl.events_in_range(tc("00:00:00;00"), tc("02:00:00;00")).size() == 3);
+
+    // Ranges are half open, touching an event is not overlapping it
+    REQUIRE(edl.events_in_range(tc("01:00:05;00"), tc("01:01:00;02")).empty());
+    REQUIRE(edl.events_in_range(tc("01:00:30;00"), tc("01:00:04;00")).empty());
+
+    // An empty range is the events playing at that time
+    REQUIRE(edl.events_in_range(tc("01:00:04;00"), tc("01:00:04;00")) == std::vector<ref>{ { 0, 0 } });
+    REQUIRE(edl.events_in_range(tc("01:00:05;00"), tc("01:00:05;00")).empty());
+
+    // Events starting at that instant are playing at it
+    REQUIRE(edl.events_in_range(tc("01:00:00;00"), tc("01:00:00;00")) == std::vector<ref>{ { 1, 0 }, { 0, 0 } });
+    REQUIRE(edl.events_in_range(tc("01:01:00;02"), tc("01:01:00;02")) == std::vector<ref>{ { 0, 1 } });
+
+    // Overlapping clips across tracks, checked against a scan of every event
+    std::mt19937_64 rng(25);
+    std::string text = "SESSION NAME:\tRanges\nSAMPLE RATE:\t48000.000000\nTIMECODE FORMAT:\t25 Frame\n\n\nT R A C K  L I S T I N G\n";
+    for (int t = 0; t < 20; ++t) {
+        text += "TRACK NAME:\tTrack " + std::to_string(t) + "\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n";
+        text += "CHANNEL \tEVENT   \tCLIP NAME\tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+        for (int e = 0; e < 50; ++e) {
+            const int start = 90000 + int(rng() % 15000);
+            const int length = 1 + int(rng() % (e % 10 == 0 ? 6000 : 200));
+            const auto frames = [](const int f) { return fmt::format("{:02}:{:02}:{:02}:{:02}", f / 90000, f / 1500 % 60, f / 25 % 60, f % 25); };
+            text += fmt::format("1\t{}\tclip\t{}\t{}\t{}\tUnmuted\n", e + 1, frames(start), frames(start + length), frames(length));
+        }
+        text += "\n\n";
+    }
+    edl.parse_file(write_temp_file("vtm_edlfile_ranges_generated.txt", text));
+
+    std::vector<typename TestType::timecode_t> bounds;
+    for (const auto& [i, track] : edl.tracks()) {
+        for (const auto& [e, event] : track.events) {
+            bounds.push_back(event.start_time);
+            bounds.push_back(event.end_time);
+        }
+    }
+
+    const auto by_position = [](const ref& a, const ref& b) { return a.track != b.track ? a.track < b.track : a.event < b.event; };
+    for (int q = 0; q < 500; ++q) {
+        auto lo = bounds[rng() % bounds.size()];
+        auto hi = bounds[rng() % bounds.size()];
+        if (q % 4 == 0) lo = (lo + hi) / 2;
+        if (q % 4 == 1) hi = lo;
+        if (hi < lo) std::swap(lo, hi);
+
+        // A point query is the events playing at it, start <= lo < end
+        std::vector<ref> expected;
+        const auto& tracks = edl.tracks();
+        for (std::size_t t = 0; t < tracks.size(); ++t) {
+            for (const auto& [e, event] : tracks[t].second.events) {
+                const bool starts = lo == hi ? event.start_time <= lo : event.start_time < hi;
+                if (starts && event.end_time > lo) expected.push_back(ref{ t, e });
+            }
+        }
+
+        auto actual = edl.events_in_range(lo, hi);
+        std::ranges::sort(actual, by_position);
+        REQUIRE(actual == expected);
+    }
+
+    edl.clear();
+    REQUIRE(edl.events_in_range(bounds.front(), bounds.back()).empty());
+}
+
+TEST_CASE("Avid PT EDL Interval Index", "[EDL File][index]")
+{
+    using index_t = vtm::edl::internal::__AvidPTIntervalIndex<double, int>;
+    const auto query = [](const index_t& index, const double lo, const double hi) {
+        std::vector<int> found;
+        index.find(lo, hi, found);
+        return found;
+    };
+
+    // Nested, repeated and empty intervals
+    const std::vector<std::pair<double, double>> fixed = { { 0, 100 }, { 10, 20 }, { 10, 20 }, { 15, 15 }, { 50, 60 }, { 20, 30 }, { 90, 100 } };
+    index_t small;
+    for (std::size_t i = 0; i < fixed.size(); ++i) small.insert(fixed[i].first, fixed[i].second, int(i));
+    small.finish();
+
+    // Those playing at lo, then those starting in range in start order
+    REQUIRE(query(small, 10, 55) == std::vector<int>{ 0, 1, 2, 3, 5, 4 });
+    REQUIRE(query(small, 95, 200) == std::vector<int>{ 0, 6 });
+    REQUIRE(query(small, 30, 20).empty());
+    REQUIRE(query(small, 100, 100).empty());
+
+    auto at = query(small, 15, 15);
+    std::ranges::sort(at);
+    REQUIRE(at == std::vector<int>{ 0, 1, 2 });
+
+    // Intervals starting at a point are playing at it, empty ones are not
+    REQUIRE(query(small, 10, 10) == std::vector<int>{ 0, 1, 2 });
+    REQUIRE(query(small, 20, 20) == std::vector<int>{ 0, 5 });
+    REQUIRE(query(small, 50, 50) == std::vector<int>{ 0, 4 });
+    REQUIRE(query(small, 0, 0) == std::vector<int>{ 0 });
+    REQUIRE(query(small, 100, 200).empty());
+
+    auto playing = query(small, 15, 16);
+    std::ranges::sort(playing);
+    REQUIRE(playing == std::vector<int>{ 0, 1, 2 });
+
+    // Random intervals, a few of them long, checked against a scan
+    std::vector<std::pair<double, double>> intervals = fixed;
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 1000; ++i) {
+        const double start = double(rng() % 1000);
+        intervals.emplace_back(start, start + double(rng() % (i % 50 == 0 ? 500 : 20)));
+    }
+
+    index_t index;
+    for (std::size_t i = 0; i < intervals.size(); ++i) index.insert(intervals[i].first, intervals[i].second, int(i));
+    index.finish();
+    REQUIRE(index.size() == intervals.size());
+
+    for (int q = 0; q < 2000; ++q) {
+        const double lo = double(rng() % 1200) - 100 + (q % 3 == 0 ? 0.5 : 0.0);
+        const double hi = q % 4 == 1 ? lo : lo + double(rng() % 100);
+
+        std::vector<int> expected;
+        for (std::size_t i = 0; i < intervals.size(); ++i) {
+            const bool starts = lo == hi ? intervals[i].first <= lo : intervals[i].first < hi;
+            if (starts && intervals[i].second > lo) expected.push_back(int(i));
+        }
+
+        auto found = query(index, lo, hi);
+        std::ranges::sort(found);
+        REQUIRE(found == expected);
+    }
+
+    index.clear();
+    REQUIRE(query(index, 0, 1000).empty());
+}
+
+namespace {
+
+auto read_file(const std::string& path) -> std::string
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+} // @END OF namespace
+
+TEMPLATE_TEST_CASE("Avid PT EDL Writer Round Trip", "[EDL File][write]", vtm::avidpt_edl, vtm::avidpt_edl_view, vtm::avidpt_edl_arena, vtm::avidpt_edl_columnar)
+{
+    // Parsed and written again, byte for byte, unparsed sections included
+    const auto path = write_temp_file("vtm_edlfile_write_source.txt", avidpt_session_text);
+    const auto copy = (std::filesystem::temp_directory_path() / "vtm_edlfile_write_copy.txt").string();
+
+    TestType edl;
+    edl.parse_file(path);
+    edl.write_file(copy);
+    REQUIRE(read_file(copy) == avidpt_session_text);
+
+    // Flushing after every track gives the same bytes
+    edl.write_file(copy, 1);
+    REQUIRE(read_file(copy) == avidpt_session_text);
+}
+
+TEMPLATE_TEST_CASE("Avid PT EDL Writer In Place", "[EDL File][write]", vtm::avidpt_edl, vtm::avidpt_edl_columnar)
+{
+    // Written over its own source, with copied sections spanning several pages
+    std::string text(avidpt_session_text);
+    for (int i = 2; i < 200; ++i) {
+        const std::string id = std::to_string(i);
+        text += id + std::string(4 - std::min<std::size_t>(id.size(), 3), ' ') + "\t01:00:00;00  \t172627           \tSamples  \tMARKER                           \t\r\n";
+    }
+    REQUIRE(text.size() > 3 * 4096);
+    const auto path = write_temp_file("vtm_edlfile_write_in_place.txt", text);
+
+    TestType edl;
+    edl.parse_file(path);
+    REQUIRE(edl.data().tracks.size() == 2);
+    edl.write_file(path);
+    REQUIRE(read_file(path) == text);
+
+    // The session still reads from the file it parsed, and writes it again
+    edl.write_file(path, 1);
+    REQUIRE(read_file(path) == text);
+}
+
+TEST_CASE("Avid PT EDL Writer Event Columns", "[EDL File][write]")
+{
+    // TIMESTAMP is not modeled, tracks with it are written in the default layout
+    const std::string_view header = "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\r\n";
+    const std::string_view row = "1       \t1       \tdx 01                         \t01:00:00;00   \t01:00:01;00   \t00:00:01;00   \tUnmuted\r\n";
+    const std::string session =
+        "SESSION NAME:\tStamps\r\nSAMPLE RATE:\t48000.000000\r\nBIT DEPTH:\t24-bit\r\n"
+        "SESSION START TIMECODE:\t01:00:00;00\r\nTIMECODE FORMAT:\t29.97 Drop Frame\r\n"
+        "# OF AUDIO TRACKS:\t1\r\n# OF AUDIO CLIPS:\t1\r\n# OF AUDIO FILES:\t1\r\n\r\n\r\n"
+        "T R A C K  L I S T I N G\r\n"
+        "TRACK NAME:\tDX 1\r\nCOMMENTS:\t\r\nUSER DELAY:\t0 Samples\r\nSTATE: \t\r\nPLUG-INS: \t\r\n";
+    const std::string stamped = session
+        + "CHANNEL \tEVENT   \tCLIP NAME                     \tSTART TIME    \tEND TIME      \tDURATION      \tTIMESTAMP     \tSTATE\r\n"
+        + "1       \t1       \tdx 01                         \t01:00:00;00   \t01:00:01;00   \t00:00:01;00   \t00:59:58;00   \tUnmuted\r\n"
+        + "\r\n\r\n";
+
+    const auto path = write_temp_file("vtm_edlfile_write_columns.txt", stamped);
+    const auto copy = (std::filesystem::temp_directory_path() / "vtm_edlfile_write_columns_copy.txt").string();
+
+    vtm::avidpt_edl edl;
+    edl.parse_file(path);
+    REQUIRE(edl.data().tracks[0].second.events[0].second.state == "Unmuted");
+    edl.write_file(copy);
+    REQUIRE(read_file(copy) == session + std::string(header) + std::string(row) + "\r\n\r\n");
+
+    vtm::avidpt_edl reparsed;
+    reparsed.parse_file(copy);
+    REQUIRE(reparsed.data().tracks[0].second.events[0].second.start_time == edl.data().tracks[0].second.events[0].second.start_time);
+    REQUIRE(reparsed.data().tracks[0].second.events[0].second.duration == edl.data().tracks[0].second.events[0].second.duration);
+}
+
+TEST_CASE("Avid PT EDL Writer Frame Rates", "[EDL File][write]")
+{
+    // Every frame of the first minutes at each rate, with and without subframes
+    for (const auto fps : { vtm::fps::fps_25, vtm::fps::fps_23p976, vtm::fps::fpsdf_29p97, vtm::fps::fps_29p97, vtm::fps::fpsdf_59p94, vtm::fps::none }) {
+        INFO("fps: " << vtm::fps::to_string(fps));
+        const bool samples = fps == vtm::fps::none;
+        const vtm::edl::internal::__AvidPTTimeFormat<vtm::chrono::float64_t> format =
+            vtm::edl::internal::__AvidPTTimeFormat<vtm::chrono::float64_t>::from_session(fps, 48000);
+
+        std::string text = "SESSION NAME:\tRates\nSAMPLE RATE:\t48000.000000\nBIT DEPTH:\t24-bit\n";
+        if (!samples) text += "SESSION START TIMECODE:\t00:00:00" + std::string(vtm::fps::is_drop_frame(fps) ? ";" : ":") + "00\n";
+        text += "TIMECODE FORMAT:\t" + std::string(__AVIDPTEDL_FPS_TO_STRING(fps)) + "\n";
+        text += "# OF AUDIO TRACKS:\t1\n# OF AUDIO CLIPS:\t0\n# OF AUDIO FILES:\t0\n\n\nT R A C K  L I S T I N G\n";
+        text += "TRACK NAME:\tA\nCOMMENTS:\t\nUSER DELAY:\t3 Frames\nSTATE: \tHidden Solo\nPLUG-INS: \t\n";
+        text += std::string(vtm::edl::internal::__AvidPTEDLWriter<vtm::edl::internal::__AvidPTEDLData<std::string, std::string_view>>::event_header) + "\n";
+
+        // Labels come from the formatter itself, valid drop-frame labels only
+        for (std::uint32_t e = 0; e < 4000; ++e) {
+            const vtm::chrono::float64_t ticks = samples ? vtm::chrono::float64_t(e * 1001) / 48000 / 100
+                                                         : vtm::chrono::float64_t(e * 7) * format.coefs[3];
+            char label[32];
+            std::string start(label, format.format_to(label, ticks));
+            if (!samples) start.resize(VTM_TCSTRING_FIXED_SIZE);
+            if (!samples && e % 3 == 0) start += "." + std::string(e % 9 == 0 ? "50" : "07");
+            start.resize(std::max<std::size_t>(start.size(), 14), ' ');
+            text += "1       \t" + std::to_string(e + 1) + std::string(8 - std::to_string(e + 1).size(), ' ') + "\tclip                          \t" + start + "\t" + start + "\t" + start + "\tUnmuted\n";
+        }
+        text += "\n\n";
+
+        const auto path = write_temp_file("vtm_edlfile_write_rates.txt", text);
+        const auto copy = (std::filesystem::temp_directory_path() / "vtm_edlfile_write_rates_copy.txt").string();
+        vtm::avidpt_edl edl;
+        edl.parse_file(path);
+        REQUIRE(edl.tracks()[0].second.events.size() == 4000);
+        edl.write_file(copy);
+        REQUIRE(read_file(copy) == text);
+    }
+}
+
+namespace {
+
+// Copies everything streamed, views are only valid during the callbacks
+struct stream_recorder
+{
+    struct track
+    {
+        std::string name;
+        std::string comments;
+        std::uint32_t delay = 0;
+        std::uint64_t state = 0;
+        std::vector<vtm::edl::internal::__AvidPTTrackEvent<std::string>> events;
+        bool ended = false;
+    };
+
+    vtm::edl::internal::__AvidPTSessionHeader<std::string> header;
+    std::size_t headers = 0;
+    std::vector<track> tracks;
+    std::vector<vtm::edl::internal::__AvidPTMarker<std::string>> markers;
+
+    void on_session_header(const vtm::edl::internal::__AvidPTSessionHeader<std::string>& h)
+    {
+        header.session_name = h.session_name;
+        header.sample_rate = h.sample_rate;
+        header.timecode_format = h.timecode_format;
+        header.session_start = h.session_start;
+        ++headers;
+    }
+
+    void on_track_begin(const vtm::edl::internal::__AvidPTTrack<std::string>& t)
+    {
+        tracks.push_back(track{ t.name, t.comments, t.delay.delay, t.state, {}, false });
+    }
+
+    void on_event(const vtm::edl::internal::__AvidPTTrack<std::string>& t, const vtm::edl::internal::__AvidPTTrackEvent<std::string_view>& e)
+    {
+        REQUIRE(t.name == tracks.back().name);
+        auto& copy = tracks.back().events.emplace_back();
+        copy.id = e.id;
+        copy.channel = e.channel;
+        copy.name = std::string(e.name);
+        copy.start_time = e.start_time;
+        copy.end_time = e.end_time;
+        copy.duration = e.duration;
+        copy.state = std::string(e.state);
+    }
+
+    void on_track_end(const vtm::edl::internal::__AvidPTTrack<std::string>& t)
+    {
+        REQUIRE(t.name == tracks.back().name);
+        tracks.back().ended = true;
+    }
+
+    void on_marker(const vtm::edl::internal::__AvidPTMarker<std::string_view>& m)
+    {
+        auto& copy = markers.emplace_back();
+        copy.id = m.id;
+        copy.location = m.location;
+        copy.time_reference = m.time_reference;
+        copy.units = std::string(m.units);
+        copy.name = std::string(m.name);
+        copy.comments = std::string(m.comments);
+    }
+};
+
+// Implements on_event only
+struct event_counter
+{
+    std::size_t events = 0;
+    void on_event(const auto&, const auto&) { ++events; }
+};
+
+} // @END OF namespace
+
+TEST_CASE("Avid PT EDL Streaming Visitor", "[EDL File][parse][stream]")
+{
+    const auto path = write_temp_file("vtm_edlfile_stream.txt", avidpt_session_text);
+    const auto tc = [](std::string_view s) { return vtm::f64timecode::from_string(s, vtm::fps::fpsdf_29p97).as_float(); };
+
+    vtm::avidpt_edl edl;
+    edl.parse_file(path);
+    const auto& expected = edl.data();
+
+    // Every chunk size splits lines in different places, down to one byte
+    for (const std::size_t chunk : { std::size_t(1), std::size_t(2), std::size_t(7), std::size_t(64), std::size_t(1) << 16 }) {
+        INFO("chunk size: " << chunk);
+        stream_recorder recorder;
+        vtm::edl::parse_stream(path, recorder, chunk);
+
+        REQUIRE(recorder.headers == 1);
+        REQUIRE(recorder.header.session_name == expected.session_name);
+        REQUIRE(recorder.header.sample_rate == expected.sample_rate);
+        REQUIRE(recorder.header.timecode_format == expected.timecode_format);
+        REQUIRE(recorder.header.session_start == expected.session_start);
+
+        REQUIRE(recorder.tracks.size() == expected.tracks.size());
+        for (std::size_t t = 0; t < recorder.tracks.size(); ++t) {
+            const auto& track = recorder.tracks[t];
+            const auto& other = expected.tracks[t].second;
+            REQUIRE(track.ended);
+            REQUIRE(track.name == other.name);
+            REQUIRE(track.comments == other.comments);
+            REQUIRE(track.delay == other.delay.delay);
+            REQUIRE(track.state == other.state);
+            REQUIRE(track.events.size() == other.events.size());
+            for (std::size_t e = 0; e < track.events.size(); ++e) {
+                REQUIRE(track.events[e].name == other.events[e].second.name);
+                REQUIRE(track.events[e].state == other.events[e].second.state);
+                REQUIRE(track.events[e].start_time == other.events[e].second.start_time);
+                REQUIRE(track.events[e].duration == other.events[e].second.duration);
+            }
+        }
+
+        REQUIRE(recorder.markers.size() == 1);
+        REQUIRE(recorder.markers[0].id == 1);
+        REQUIRE(recorder.markers[0].location == tc("01:00:00;00"));
+        REQUIRE(recorder.markers[0].time_reference == 172627);
+        REQUIRE(recorder.markers[0].units == "Samples");
+        REQUIRE(recorder.markers[0].name == "FFOA");
+        REQUIRE(recorder.markers[0].comments == "");
+    }
+
+    // Callbacks are optional, a last line without a terminator is parsed
+    event_counter events;
+    const auto unterminated = write_temp_file("vtm_edlfile_stream_unterminated.txt",
+        "TIMECODE FORMAT:\t25 Frame\nT R A C K  L I S T I N G\nTRACK NAME:\tA\n"
+        "CHANNEL\tEVENT\tCLIP NAME\tSTART TIME\tEND TIME\tDURATION\tSTATE\n1\t1\tclip\t01:00:00:00\t01:00:01:00\t00:00:01:00\tUnmuted");
+    vtm::edl::parse_stream(unterminated, events, 5);
+    REQUIRE(events.events == 1);
+
+    // Errors name the line however the text was chunked
+    const auto broken = write_temp_file("vtm_edlfile_stream_broken.txt",
+        "TIMECODE FORMAT:\t25 Frame\nT R A C K  L I S T I N G\nTRACK NAME:\tA\n"
+        "CHANNEL\tEVENT\tCLIP NAME\tSTART TIME\tEND TIME\tDURATION\tSTATE\n1\t1\tclip\tbad\t01:00:01:00\t00:00:01:00\tUnmuted\n");
+    REQUIRE_THROWS_WITH(vtm::edl::parse_stream(broken, events, 3), Catch::Matchers::StartsWith("line 5:"));
+    REQUIRE_THROWS_AS(vtm::edl::parse_stream("./resources/txt/foo.txt", events), std::runtime_error);
+}
+
+TEST_CASE("vtm::utility::string_arena Interning", "[utility][arena]")
+{
+    vtm::utility::string_arena arena(4);
+    std::string a = "clip";
+    const auto first = arena.intern(a);
+    a[0] = 'x';
+
+    REQUIRE(first == "clip");
+    REQUIRE(arena.intern("clip").data() == first.data());
+    REQUIRE(arena.intern("xlip") != first);
+    REQUIRE(arena.intern("").empty());
+    REQUIRE(arena.size() == 2);
+    REQUIRE(arena.bytes() == 8);
+
+    // Concurrent interning agrees on one copy per string
+    std::vector<std::thread> threads;
+    std::vector<std::vector<std::string_view>> views(4);
+    for (std::size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 1000; ++i) views[t].push_back(arena.intern("name " + std::to_string(i % 100)));
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (std::size_t t = 1; t < 4; ++t) REQUIRE(views[t] == views[0]);
+    for (std::size_t i = 0; i < 1000; ++i) REQUIRE(views[1][i].data() == views[0][i].data());
+    REQUIRE(arena.size() == 102);
+
+    arena.clear();
+    REQUIRE(arena.size() == 0);
+    REQUIRE(arena.intern("clip") == "clip");
+}
+
+TEST_CASE("vtm::utility::thread_pool Nested Loops", "[utility][parallel]")
+{
+    // Every worker busy in an outer loop, the inner loops still complete
+    for (const std::size_t workers : { 0, 1, 3 }) {
+        vtm::utility::thread_pool pool(workers);
+        std::vector<std::atomic<std::size_t>> sums(16);
+        pool.parallel_for(sums.size(), [&](const std::size_t i) {
+            pool.parallel_for(100, [&](const std::size_t j) { sums[i] += j; });
+        });
+        for (const auto& sum : sums) REQUIRE(sum == 4950);
+    }
+
+    // Submitted tasks run before the pool is destroyed
+    std::atomic<int> ran = 0;
+    {
+        vtm::utility::thread_pool pool(2);
+        for (int i = 0; i < 100; ++i) pool.submit([&]() { ++ran; });
+    }
+    REQUIRE(ran == 100);
+
+    vtm::utility::thread_pool pool(2);
+    REQUIRE_THROWS_AS(pool.parallel_for(50, [](const std::size_t i) { if (i == 25) throw std::runtime_error("stop"); }), std::runtime_error);
+    REQUIRE_FALSE(pool.run_pending_task());
+}
+
+TEST_CASE("Avid PT EDL Batch Ingest", "[EDL File][parse][parallel]")
+{
+    // Files of uneven size, one missing and one broken, the large ones parsed
+    // track by track
+    std::vector<std::string> paths;
+    for (int f = 0; f < 24; ++f) {
+        const int tracks = f % 5 == 0 ? 120 : 2;
+        std::string text = "SESSION NAME:\tReel " + std::to_string(f) + "\nSAMPLE RATE:\t48000.000000\nTIMECODE FORMAT:\t25 Frame\n\n\nT R A C K  L I S T I N G\n";
+        for (int t = 0; t < tracks; ++t) {
+            text += "TRACK NAME:\tTrack " + std::to_string(t) + "\nCOMMENTS:\t\nUSER DELAY:\t0 Samples\nSTATE: \t\nPLUG-INS: \t\n";
+            text += "CHANNEL \tEVENT   \tCLIP NAME\tSTART TIME    \tEND TIME      \tDURATION      \tSTATE\n";
+            for (int e = 0; e < 5; ++e) {
+                text += "1\t" + std::to_string(e + 1) + "\tclip " + std::to_string(f) + "\t01:00:0" + std::to_string(e) + ":00\t01:00:0" + std::to_string(e + 1) + ":00\t00:00:01:00\tUnmuted\n";
+            }
+            text += "\n\n";
+        }
+        if (f == 7) text += "TRACK NAME:\tBroken\nCHANNEL\tEVENT\tCLIP NAME\tSTART TIME\tEND TIME\tDURATION\tSTATE\n1\t1\tclip\tnot a time\t01:00:01:00\t00:00:01:00\tUnmuted\n";
+        paths.push_back(write_temp_file("vtm_edlfile_ingest_" + std::to_string(f) + ".txt", text));
+    }
+    paths.insert(paths.begin() + 3, "./resources/txt/foo.txt");
+
+    vtm::utility::thread_pool pool(3);
+    vtm::edl::ingest_options options;
+    options.pool = &pool;
+    options.split_size = 1 << 12;
+
+    const auto results = vtm::edl::ingest(paths, options);
+    REQUIRE(results.size() == paths.size());
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        INFO("file: " << paths[i]);
+        const auto& result = results[i];
+        REQUIRE(result.path == paths[i]);
+
+        if (i == 3) {
+            REQUIRE_FALSE(result.ok());
+            REQUIRE(result.error.find("foo.txt") != std::string::npos);
+            continue;
+        }
+
+        const int f = int(i < 3 ? i : i - 1);
+        if (f == 7) {
+            REQUIRE_FALSE(result.ok());
+            REQUIRE_THAT(result.error, Catch::Matchers::StartsWith("line "));
+            REQUIRE(result.edl.session().tracks.empty());
+            continue;
+        }
+
+        vtm::avidpt_edl serial;
+        serial.parse_file(paths[i]);
+        REQUIRE(result.ok());
+        REQUIRE(result.edl.session().session_name == "Reel " + std::to_string(f));
+        REQUIRE(result.edl.tracks().size() == serial.tracks().size());
+        for (std::size_t t = 0; t < serial.tracks().size(); ++t) {
+            REQUIRE(result.edl[t].name == serial[t].name);
+            REQUIRE(result.edl[t].events.size() == 5);
+            REQUIRE(result.edl[t].events[4].second.start_time == serial[t].events[4].second.start_time);
+        }
+    }
+
+    // A pool of the call's own, and string views as paths
+    const std::vector<std::string_view> views(paths.begin(), paths.begin() + 3);
+    const auto columnar = vtm::edl::ingest<vtm::avidpt_edl_columnar>(views);
+    REQUIRE(columnar.size() == 3);
+    REQUIRE(columnar[0].ok());
+    REQUIRE(columnar[0].edl.tracks().size() == 120);
+    REQUIRE(vtm::edl::ingest(std::vector<std::string>{}).empty());
+}
@@ -39,3 +39,69 @@ TEST_CASE("vtm::fps Conversion", "[timecode][chrono][framerate][conversion][stat
     REQUIRE(fps_float_60 == 60.0);    REQUIRE(fps_int_60 == 60);   REQUIRE(fps_str_60 == "60 fps");
 }
 
+
+TEST_CASE("vtm::fps Mapping Round Trip", "[timecode][chrono][framerate][conversion][static]")
+{
+    using namespace vtm::chrono;
+
+    for (const auto f : { fps::fps_24, fps::fps_25, fps::fps_30, fps::fps_29p97, fps::fpsdf_29p97, fps::fps_60,
+                          fps::fps_23p976, fps::fps_48, fps::fps_50, fps::fps_59p94, fps::fpsdf_59p94,
+                          fps::fps_100, fps::fps_119p88, fps::fps_120 }) {
+        INFO("fps: " << fps::to_string(f));
+        REQUIRE(fps::from_string(fps::to_string(f)) == f);
+        REQUIRE(fps::from_string(std::string(fps::to_string(f))) == f);
+        REQUIRE(fps::from_float(__FPSFORMAT_VALUE_TO_FLOAT(f)) == f);
+        REQUIRE(fps::from_int(__FPSFORMAT_VALUE_TO_INT(f)) == f);
+    }
+
+    // Duplicate values resolve to the first mapping
+    REQUIRE(__FPSFORMAT_DROPFRAME_TO_VALUE(false) == fps::fps_24);
+    REQUIRE(__FPSFORMAT_DROPFRAME_TO_VALUE(true) == fps::fpsdf_29p97);
+
+    // The default enumerator maps to the default value, unknown values to the default enumerator
+    REQUIRE(fps::to_string(fps::none) == "NONE");
+    REQUIRE(fps::to_float(fps::none) == 0.0);
+    REQUIRE(static_cast<int>(fps::none) == 6);
+    REQUIRE(fps::from_int(0) == fps::none);
+    REQUIRE(fps::from_string(std::string_view("NONE")) == fps::none);
+    REQUIRE(fps::from_float(0.0) == fps::none);
+    REQUIRE(fps::from_string(std::string_view("23.98 fps")) == fps::none);
+    REQUIRE(fps::from_float(23.98) == fps::none);
+    REQUIRE(fps::from_float(-0.0) == fps::none);
+}
+
+
+TEST_CASE("vtm::fps Rate Registry", "[timecode][chrono][framerate][static]")
+{
+    using namespace vtm::chrono;
+
+    REQUIRE(fps::to_rational(fps::fps_23p976).num == 24000);  REQUIRE(fps::to_rational(fps::fps_23p976).den == 1001);
+    REQUIRE(fps::to_rational(fps::fps_59p94).num == 60000);   REQUIRE(fps::to_rational(fps::fps_59p94).den == 1001);
+    REQUIRE(fps::to_rational(fps::fps_119p88).num == 120000); REQUIRE(fps::to_rational(fps::fps_119p88).den == 1001);
+    REQUIRE(fps::to_rational(fps::fps_50).num == 50);         REQUIRE(fps::to_rational(fps::fps_50).den == 1);
+
+    REQUIRE(fps::to_float(fps::fps_23p976) == 23.976);   REQUIRE(fps::to_int(fps::fps_23p976) == 23);
+    REQUIRE(fps::to_float(fps::fpsdf_59p94) == 59.94);   REQUIRE(fps::to_int(fps::fpsdf_59p94) == 59);
+    REQUIRE(fps::to_string(fps::fps_119p88) == "119.88 fps");
+    REQUIRE(fps::to_string(fps::fpsdf_59p94) == "59.94 fps drop-frame");
+
+    REQUIRE(fps::to_nominal(fps::fps_23p976) == 24);
+    REQUIRE(fps::to_nominal(fps::fpsdf_59p94) == 60);
+    REQUIRE(fps::to_nominal(fps::fps_119p88) == 120);
+    REQUIRE(fps::to_single_tick(fps::fps_50) == vtm::fpsfloat_t(1.0) / vtm::fpsfloat_t(50.0) / vtm::fpsfloat_t(100.0));
+
+    REQUIRE(fps::is_drop_frame(fps::fpsdf_59p94));
+    REQUIRE_FALSE(fps::is_drop_frame(fps::fps_59p94));
+    REQUIRE(fps::from_int(-59) == fps::fpsdf_59p94);
+    REQUIRE(fps::from_float(-59.94) == fps::fpsdf_59p94);
+
+    // 59.94 drop-frame skips four frame numbers per minute
+    const auto tc = vtm::f64timecode::from_string("00:01:00;04", fps::fpsdf_59p94);
+    REQUIRE(tc.as_string() == "00:01:00;04");
+    REQUIRE(vtm::f64timecode::from_string("00:00:59;59", fps::fpsdf_59p94).as_string() == "00:00:59;59");
+    REQUIRE(vtm::f64timecode::from_string("00:10:00;00", fps::fpsdf_59p94).as_string() == "00:10:00;00");
+
+    const auto r = vtm::r64timecode::from_string("01:00:00:00", fps::fps_23p976);
+    REQUIRE(r.frames() == 3600 * 24);
+    REQUIRE(r.as_string() == "01:00:00:00");
+}
@@ -0,0 +1,90 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "catch2/catch_message.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "timecode.hpp"
+#include <cmath>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("vtm::chrono Batch Timecode Parsing", "[timecode][chrono][batch][parsing]")
+{
+    using namespace vtm::chrono;
+
+    const std::vector<std::string_view> in{
+        "00:00:00:00", "01:02:03:04", "bad", "10:00:00;02", "23:59:59:24",
+        "23:59:5x:24", "100:00:00:00", "01:00:00:00", "", "00:00:01:00", "99:99:99:99"
+    };
+
+    std::vector<vtm::fpsfloat_t> out(in.size(), -1.0);
+    std::vector<std::uint64_t> invalid(tcbitmap_words(in.size()), ~std::uint64_t{0});
+
+    const auto invalid_count = parse_timecodes(in, vtm::fps::fps_25, out, invalid);
+    REQUIRE(invalid_count == 3);
+
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        INFO("timecode string: " << in[i]);
+        const bool expect_invalid = (i == 2 || i == 5 || i == 8);
+        REQUIRE(tcbitmap_test(invalid, i) == expect_invalid);
+
+        if (expect_invalid) REQUIRE(out[i] == 0.0);
+        else REQUIRE(out[i] == tcstring_to_ticks(in[i], fps::to_float(vtm::fps::fps_25)));
+    }
+
+    // Bitmap is optional
+    REQUIRE(parse_timecodes(std::span(in).first(3), vtm::fps::fps_25, out) == 1);
+
+    // Wide labels with extra fields, non-digits or high-bit bytes are flagged
+    const std::vector<std::string_view> wide{
+        "00:00:00:00:00", "100:00:00:00:00", "1x0:00:00:00", "100:0x:00:00", "\xb9\xb2\xb3:00:00:00",
+        "100:00:00:\xff\xff", "100:00:00:01", "100:00::00:01", "100:00:00:01 "
+    };
+    std::vector<long double> wide_out(wide.size(), -1.0L);
+    std::vector<std::uint64_t> wide_invalid(tcbitmap_words(wide.size()));
+
+    REQUIRE(parse_timecodes(wide, 25.0L, false, std::span(wide_out), wide_invalid) == 8);
+    for (std::size_t i = 0; i < wide.size(); ++i) {
+        INFO("timecode string: " << wide[i]);
+        REQUIRE(tcbitmap_test(wide_invalid, i) == (i != 6));
+        if (i != 6) REQUIRE(wide_out[i] == 0.0L);
+    }
+    REQUIRE(wide_out[6] == tcstring_to_ticks(wide[6], 25.0L));
+    REQUIRE_FALSE(valid_tcstring(wide[0]));
+    REQUIRE_FALSE(valid_tcstring(wide[4]));
+}
+
+TEST_CASE("vtm::chrono Batch Timecode Formatting", "[timecode][chrono][batch][formatting]")
+{
+    using namespace vtm::chrono;
+
+    std::vector<vtm::fpsfloat_t> in;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 23; ++i) {
+        const auto tc = vtm::f64timecode::from_hmsf(i, (i * 7) % 60, (i * 13) % 60, i % 25, vtm::fps::fps_25);
+        in.push_back(tc.as_float());
+        expected.push_back(tc.as_string());
+    }
+
+    in[5] = -1.0;
+    in[17] = std::numeric_limits<vtm::fpsfloat_t>::quiet_NaN();
+    expected[5] = expected[17] = "00:00:00:00";
+
+    std::string out(in.size() * VTM_TCSTRING_FIXED_SIZE, '\0');
+    std::vector<std::uint64_t> invalid(tcbitmap_words(in.size()));
+
+    REQUIRE(format_timecodes(in, vtm::fps::fps_25, out.data(), invalid) == 2);
+
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        INFO("entry: " << i);
+        REQUIRE(std::string_view(out).substr(i * VTM_TCSTRING_FIXED_SIZE, VTM_TCSTRING_FIXED_SIZE) == expected[i]);
+        REQUIRE(tcbitmap_test(invalid, i) == (i == 5 || i == 17));
+    }
+
+    std::string df_out(VTM_TCSTRING_FIXED_SIZE * 6, '\0');
+    const std::vector<vtm::fpsfloat_t> df_in(6, 36.0);
+    REQUIRE(format_timecodes(df_in, vtm::fps::fpsdf_29p97, df_out.data()) == 0);
+    REQUIRE(df_out.substr(0, VTM_TCSTRING_FIXED_SIZE) == "01:00:00;00");
+    REQUIRE(df_out.substr(5 * VTM_TCSTRING_FIXED_SIZE) == "01:00:00;00");
+}
@@ -0,0 +1,133 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "catch2/catch_message.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "timecode.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+auto make_column(const std::size_t count, const vtm::fps::type fps, const std::uint64_t seed) -> vtm::timecode_column
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> frames(0, 24 * 3600 * 25);
+
+    vtm::timecode_column column{ fps };
+    for (std::size_t i = 0; i < count; ++i) column.push_back(vtm::fpsfloat_t(frames(rng)) / 2500.0);
+    return column;
+}
+
+} // @END OF namespace
+
+TEST_CASE("vtm::timecode_column Element Access", "[timecode][chrono][column]")
+{
+    const std::vector<vtm::f64timecode> tcs {
+        vtm::f64timecode::from_string("01:00:00:00", vtm::fps::fps_25),
+        vtm::f64timecode::from_string("00:00:10:12", vtm::fps::fps_25),
+        vtm::f64timecode::from_string("23:59:59:24", vtm::fps::fps_25),
+    };
+
+    vtm::timecode_column column{ tcs, vtm::fps::fps_25 };
+    REQUIRE(column.size() == 3);
+    REQUIRE(column.fps() == vtm::fps::fps_25);
+    REQUIRE(column[0] == tcs[0]);
+    REQUIRE(column.at(1).as_string() == "00:00:10:12");
+
+    column.set(1, vtm::f64timecode::from_string("00:00:00:01", vtm::fps::fps_25));
+    REQUIRE(column[1].as_string() == "00:00:00:01");
+    REQUIRE(column.min().as_string() == "00:00:00:01");
+    REQUIRE(column.max().as_string() == "23:59:59:24");
+
+    std::string out(column.size() * VTM_TCSTRING_FIXED_SIZE, '\0');
+    REQUIRE(column.format_to(out.data()) == 0);
+    REQUIRE(out == "01:00:00:0000:00:00:0123:59:59:24");
+}
+
+TEST_CASE("vtm::timecode_column Matches f64timecode Arithmetic", "[timecode][chrono][column]")
+{
+    // Odd size so the scalar tail of every kernel runs
+    const auto source = make_column(1003, vtm::fps::fps_25, 7);
+    const auto offset = vtm::f64timecode::from_string("00:59:50:00", vtm::fps::fps_25);
+
+    auto shifted = source;
+    shifted.offset(offset);
+
+    auto pulled = source;
+    pulled.offset(-offset.as_float());
+
+    auto clamped = source;
+    clamped.clamp(vtm::f64timecode::from_string("01:00:00:00", vtm::fps::fps_25),
+                  vtm::f64timecode::from_string("02:00:00:00", vtm::fps::fps_25));
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < source.size(); ++i) {
+        mismatches += shifted[i].as_string() != (source[i] + offset).as_string();
+        mismatches += pulled[i].as_string() != (source[i] - offset).as_string();
+        mismatches += clamped[i] < vtm::f64timecode::from_string("01:00:00:00", vtm::fps::fps_25);
+        mismatches += clamped[i] > vtm::f64timecode::from_string("02:00:00:00", vtm::fps::fps_25);
+    }
+    REQUIRE(mismatches == 0);
+
+    auto scaled = source;
+    scaled.scale(1001.0 / 1000.0);
+    for (std::size_t i = 0; i < source.size(); ++i) {
+        REQUIRE(scaled.values()[i] == source.values()[i] * (1001.0 / 1000.0));
+    }
+
+    const auto values = source.values();
+    REQUIRE(source.min().as_float() == *std::min_element(values.begin(), values.end()));
+    REQUIRE(source.max().as_float() == *std::max_element(values.begin(), values.end()));
+}
+
+TEST_CASE("vtm::timecode_column Diff & Compare", "[timecode][chrono][column]")
+{
+    const auto a = make_column(517, vtm::fps::fps_25, 1);
+    const auto b = make_column(517, vtm::fps::fps_25, 2);
+
+    std::vector<double> delta(a.size());
+    a.diff(b, delta);
+
+    std::vector<std::int8_t> order(a.size());
+    a.compare(b, order);
+
+    const auto pivot = a[0];
+    std::vector<std::int8_t> against_pivot(a.size());
+    a.compare(pivot, against_pivot);
+
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        INFO("index: " << i);
+        REQUIRE(delta[i] == a.values()[i] - b.values()[i]);
+        REQUIRE(order[i] == ((a[i] > b[i]) ? 1 : (a[i] < b[i]) ? -1 : 0));
+        REQUIRE(against_pivot[i] == ((a[i] > pivot) ? 1 : (a[i] < pivot) ? -1 : 0));
+    }
+    REQUIRE(against_pivot[0] == 0);
+}
+
+TEST_CASE("vtm::chrono Column Sum & Overlap Kernels", "[timecode][chrono][column]")
+{
+    // Odd size so the scalar tail of every kernel runs
+    const auto starts = make_column(1003, vtm::fps::fps_25, 3);
+    std::vector<double> ends(starts.size());
+    for (std::size_t i = 0; i < ends.size(); ++i) ends[i] = starts.values()[i] + double(i % 50) / 25.0;
+
+    double expected_sum = 0.0;
+    for (const double v : starts.values()) expected_sum += v;
+    REQUIRE(vtm::chrono::internal::column_sum(starts.values()) == Catch::Approx(expected_sum));
+    REQUIRE(vtm::chrono::internal::column_sum(std::span<const double>{}) == 0.0);
+
+    const double lo = 300.0;
+    const double hi = 400.0;
+    std::vector<std::size_t> hits;
+    vtm::chrono::internal::column_overlaps(starts.values(), std::span<const double>(ends), lo, hi, hits);
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < ends.size(); ++i) {
+        if (starts.values()[i] < hi && ends[i] > lo) expected.push_back(i);
+    }
+    REQUIRE(!expected.empty());
+    REQUIRE(hits == expected);
+}
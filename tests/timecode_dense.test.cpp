@@ -0,0 +1,83 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "catch2/catch_message.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "timecode.hpp"
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Layout guarantees, values can be memcpy'd and packed two per 32 bytes
+static_assert(std::is_trivially_copyable_v<vtm::dense_timecode>);
+static_assert(std::is_standard_layout_v<vtm::dense_timecode>);
+static_assert(std::is_trivially_destructible_v<vtm::dense_timecode>);
+static_assert(sizeof(vtm::dense_timecode) <= 16);
+static_assert(sizeof(vtm::dense_timecode) < sizeof(vtm::f64timecode));
+
+TEST_CASE("vtm::dense_timecode Matches f64timecode", "[timecode][chrono][dense]")
+{
+    for (const auto fps : { vtm::fps::fps_24, vtm::fps::fps_25, vtm::fps::fps_29p97, vtm::fps::fpsdf_29p97, vtm::fps::fps_30, vtm::fps::fps_60 }) {
+        for (const auto label : { "00:00:00:00", "00:00:59:23", "00:10:00:00", "10:00:00:01", "23:59:59:15" }) {
+            std::string str(label);
+            if (vtm::fps::is_drop_frame(fps)) str[8] = ';';
+
+            const auto dense = vtm::dense_timecode::from_string(str, fps);
+            const auto f64 = vtm::f64timecode::from_string(str, fps);
+
+            INFO("fps: " << vtm::fps::to_float(fps) << " timecode: " << str);
+            REQUIRE(dense.as_string() == str);
+            REQUIRE(dense.as_string() == f64.as_string());
+            REQUIRE(dense.as_float() == Catch::Approx(f64.as_float()));
+            REQUIRE(dense.fps() == f64.fps());
+            REQUIRE(dense.is_drop_frame() == vtm::fps::is_drop_frame(fps));
+            REQUIRE(vtm::chrono::to_dense_timecode(f64).as_string() == str);
+            REQUIRE(vtm::chrono::to_f64timecode(dense).as_string() == str);
+        }
+    }
+
+    const auto dense = vtm::dense_timecode::from_hmsf(1, 2, 3, 4, vtm::fps::fps_25);
+    REQUIRE(dense.as_string() == vtm::f64timecode::from_hmsf(1, 2, 3, 4, vtm::fps::fps_25).as_string());
+    REQUIRE(fmt::format("{}", dense) == "01:02:03:04");
+
+    const auto [ticks, fps] = dense;
+    REQUIRE(ticks == dense.as_float());
+    REQUIRE(fps == vtm::fps::fps_25);
+}
+
+TEST_CASE("vtm::dense_timecode Arithmetic & Comparison", "[timecode][chrono][dense]")
+{
+    const auto a = vtm::dense_timecode::from_string("01:00:00:00", vtm::fps::fps_25);
+    const auto b = vtm::dense_timecode::from_string("00:00:01:00", vtm::fps::fps_25);
+
+    REQUIRE((a + b).as_string() == "01:00:01:00");
+    REQUIRE((a - b).as_string() == "00:59:59:00");
+    REQUIRE((b - a).as_float() == 0.0);
+    REQUIRE((b + 36.0).as_string() == "01:00:01:00");
+    REQUIRE(b < a);
+    REQUIRE(a == vtm::dense_timecode{ 36.0, vtm::fps::fps_25 });
+    REQUIRE_FALSE(a == vtm::dense_timecode{ 36.0, vtm::fps::fps_24 });
+    REQUIRE_FALSE(b < vtm::dense_timecode{ 36.0, vtm::fps::fps_24 });
+
+    auto c = a;
+    c -= 100.0;
+    REQUIRE(c.as_float() == 0.0);
+    c = a;
+    c.reset();
+    REQUIRE(c.as_string() == "00:00:00:00");
+    REQUIRE(c.fps() == vtm::fps::fps_25);
+}
+
+TEST_CASE("vtm::dense_timecode Bytewise Copy", "[timecode][chrono][dense]")
+{
+    std::vector<vtm::dense_timecode> src;
+    for (int i = 0; i < 64; ++i) src.emplace_back(vtm::fpsfloat_t(i) * 0.04, vtm::fps::fps_25);
+
+    std::vector<vtm::dense_timecode> dst(src.size());
+    std::memcpy(dst.data(), src.data(), src.size() * sizeof(vtm::dense_timecode));
+    REQUIRE(dst == src);
+
+    // Moving leaves the source untouched
+    auto moved = std::move(src);
+    REQUIRE(moved == dst);
+}
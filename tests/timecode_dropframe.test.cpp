@@ -0,0 +1,174 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "catch2/catch_message.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "timecode.hpp"
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+auto dropframe_label(const std::uint64_t frames, const std::uint64_t nominal = 30) -> std::string
+{
+    char buffer[VTM_TCSTRING_FIXED_SIZE];
+    vtm::chrono::format_tcstring_fixed(buffer, vtm::chrono::dropframe_to_fields(frames, nominal));
+    return std::string(buffer, VTM_TCSTRING_FIXED_SIZE);
+}
+
+} // @END OF namespace
+
+TEST_CASE("vtm::chrono Drop-Frame Label Table", "[timecode][chrono][dropframe]")
+{
+    using namespace vtm::chrono;
+
+    const std::array<std::pair<std::uint64_t, std::string_view>, 12> table_2997{{
+        { 0,       "00:00:00;00" },
+        { 1799,    "00:00:59;29" },
+        { 1800,    "00:01:00;02" },
+        { 3597,    "00:01:59;29" },
+        { 3598,    "00:02:00;02" },
+        { 17981,   "00:09:59;29" },
+        { 17982,   "00:10:00;00" },
+        { 17983,   "00:10:00;01" },
+        { 19782,   "00:11:00;02" },
+        { 107892,  "01:00:00;00" },
+        { 2589407, "23:59:59;29" },
+        { 2589408, "24:00:00;00" },
+    }};
+
+    for (const auto& [frames, label] : table_2997) {
+        INFO("frames: " << frames);
+        REQUIRE(dropframe_label(frames) == label);
+
+        tcstring_fields fields;
+        REQUIRE(parse_tcstring_fixed(label, fields));
+        REQUIRE(valid_dropframe_fields(fields));
+        REQUIRE(fields_to_dropframe(fields) == frames);
+    }
+
+    const std::array<std::pair<std::uint64_t, std::string_view>, 5> table_5994{{
+        { 3599,    "00:00:59;59" },
+        { 3600,    "00:01:00;04" },
+        { 35964,   "00:10:00;00" },
+        { 215784,  "01:00:00;00" },
+        { 5178816, "24:00:00;00" },
+    }};
+
+    for (const auto& [frames, label] : table_5994) {
+        INFO("frames: " << frames);
+        REQUIRE(dropframe_label(frames, 60) == label);
+
+        tcstring_fields fields;
+        REQUIRE(parse_tcstring_fixed(label, fields));
+        REQUIRE(fields_to_dropframe(fields, 60) == frames);
+    }
+
+    tcstring_fields fields;
+    for (const auto label : { "00:01:00;00", "00:01:00;01", "01:59:00;01", "00:00:00;30", "00:60:00;00" }) {
+        INFO("label: " << label);
+        REQUIRE(parse_tcstring_fixed(std::string_view(label), fields));
+        REQUIRE_FALSE(valid_dropframe_fields(fields));
+    }
+
+    REQUIRE(parse_tcstring_fixed(std::string_view("00:01:00;03"), fields));
+    REQUIRE_FALSE(valid_dropframe_fields(fields, 60));
+}
+
+TEST_CASE("vtm::chrono Drop-Frame 24h Round Trip", "[timecode][chrono][dropframe]")
+{
+    using namespace vtm::chrono;
+
+    // Every frame of a day maps to a valid label one frame after its predecessor
+    // and back to itself, checked for both the scalar and the batched paths
+    constexpr std::uint64_t frames = 2589408;
+    std::vector<std::uint64_t> in(frames);
+    std::iota(in.begin(), in.end(), 0);
+
+    std::string out(frames * VTM_TCSTRING_FIXED_SIZE, '\0');
+    format_dropframe(in, out.data());
+
+    std::vector<std::string_view> labels(frames);
+    for (std::uint64_t i = 0; i < frames; ++i) {
+        labels[i] = std::string_view(out).substr(i * VTM_TCSTRING_FIXED_SIZE, VTM_TCSTRING_FIXED_SIZE);
+    }
+
+    std::vector<std::uint64_t> parsed(frames);
+    std::vector<std::uint64_t> invalid(tcbitmap_words(frames));
+    REQUIRE(parse_dropframe(labels, parsed, invalid) == 0);
+    REQUIRE(parsed == in);
+
+    std::uint64_t mismatches = 0;
+    tcstring_fields prev = dropframe_to_fields(0);
+    for (std::uint64_t i = 1; i < frames; ++i) {
+        const tcstring_fields fields = dropframe_to_fields(i);
+        const bool valid = valid_dropframe_fields(fields) && fields_to_dropframe(fields) == i;
+
+        // Labels only ever advance by one frame number, or skip the dropped ones
+        const std::uint64_t step = fields_to_dropframe(fields) - fields_to_dropframe(prev);
+        mismatches += !valid || step != 1 || labels[i] != dropframe_label(i);
+        prev = fields;
+    }
+
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("vtm::f64timecode Drop-Frame Conversion", "[timecode][chrono][dropframe][conversion]")
+{
+    const auto tc_1 = vtm::f64timecode::from_string("00:01:00;02", vtm::fps::fpsdf_29p97);
+    REQUIRE(tc_1.as_string() == "00:01:00;02");
+    REQUIRE(tc_1.as_float() == Catch::Approx(1800.0 / 29.97 / 100.0));
+
+    const auto tc_2 = vtm::f64timecode::from_hmsf(0, 10, 0, 0, vtm::fps::fpsdf_29p97);
+    REQUIRE(tc_2.as_string() == "00:10:00;00");
+
+    const vtm::f64timecode tc_3{36.0, vtm::fps::fpsdf_29p97};
+    REQUIRE(tc_3.as_string() == "01:00:00;00");
+    REQUIRE(vtm::f64timecode::from_string("01:00:00;00", vtm::fps::fpsdf_29p97).as_float() == Catch::Approx(36.0));
+
+    for (const auto label : { "00:00:59;29", "00:09:59;29", "10:00:00;00", "23:59:59;29" }) {
+        INFO("label: " << label);
+        REQUIRE(vtm::f64timecode::from_string(label, vtm::fps::fpsdf_29p97).as_string() == label);
+    }
+
+    const std::vector<std::string_view> in{ "00:01:00;02", "00:01:00;00", "01:00:00;00" };
+    std::vector<vtm::fpsfloat_t> ticks(in.size());
+    std::vector<std::uint64_t> invalid(vtm::chrono::tcbitmap_words(in.size()));
+    REQUIRE(vtm::chrono::parse_timecodes(in, vtm::fps::fpsdf_29p97, ticks, invalid) == 1);
+    REQUIRE(vtm::chrono::tcbitmap_test(invalid, 1));
+    REQUIRE(ticks[0] == tc_1.as_float());
+
+    // Wide hour labels are checked too, dropped and out of range ones are flagged
+    const std::vector<std::string_view> wide{ "100;01;00;00", "100:01:00;00", "100:01:00;02", "100:00:60;00", "1x0:00:00;00", "100:10:00;00" };
+    std::vector<vtm::fpsfloat_t> wide_ticks(wide.size(), -1.0);
+    std::vector<std::uint64_t> wide_invalid(vtm::chrono::tcbitmap_words(wide.size()));
+    REQUIRE(vtm::chrono::parse_timecodes(wide, vtm::fps::fpsdf_29p97, wide_ticks, wide_invalid) == 4);
+    for (const std::size_t i : { 0, 1, 3, 4 }) {
+        REQUIRE(vtm::chrono::tcbitmap_test(wide_invalid, i));
+        REQUIRE(wide_ticks[i] == 0.0);
+    }
+    REQUIRE(wide_ticks[2] == Catch::Approx(double(vtm::chrono::fields_to_dropframe({ 100, 1, 0, 2, true })) / 29.97 / 100.0));
+    REQUIRE(wide_ticks[5] == Catch::Approx(double(vtm::chrono::fields_to_dropframe({ 100, 10, 0, 0, true })) / 29.97 / 100.0));
+
+    std::string out(in.size() * VTM_TCSTRING_FIXED_SIZE, '\0');
+    REQUIRE(vtm::chrono::format_timecodes(std::span<const vtm::fpsfloat_t>(ticks), vtm::fps::fpsdf_29p97, out.data()) == 0);
+    REQUIRE(out == "00:01:00;0200:00:00;0001:00:00;00");
+}
+
+TEST_CASE("vtm::r64timecode Drop-Frame Conversion", "[timecode][chrono][dropframe][rational]")
+{
+    const auto tc = vtm::r64timecode::from_string("00:01:00;02", vtm::fps::fpsdf_29p97);
+    REQUIRE(tc.frames() == 1800);
+    REQUIRE(tc.as_string() == "00:01:00;02");
+    REQUIRE((tc - 100).as_string() == "00:00:59;29");
+
+    const auto hour = vtm::r64timecode::from_hmsf(1, 0, 0, 0, vtm::fps::fpsdf_29p97);
+    REQUIRE(hour.frames() == 107892);
+    REQUIRE(hour.seconds() == Catch::Approx(3600.0).epsilon(1e-5));
+    REQUIRE(vtm::chrono::to_f64timecode(hour).as_string() == "01:00:00;00");
+    REQUIRE(vtm::chrono::to_r64timecode(vtm::f64timecode{36.0, vtm::fps::fpsdf_29p97}) == hour);
+}
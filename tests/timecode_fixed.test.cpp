@@ -0,0 +1,73 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "catch2/catch_message.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "timecode.hpp"
+#include <string>
+#include <string_view>
+
+// Conversion constants are available at compile time
+static_assert(vtm::fixed_timecode<vtm::fps::fps_25>::coefs[0] == 36.0);
+static_assert(vtm::fixed_timecode<vtm::fps::fps_24>::nominal == 24);
+static_assert(vtm::fixed_timecode<vtm::fps::fpsdf_29p97>::drop_frame);
+static_assert(vtm::fixed_timecode<vtm::fps::fpsdf_29p97>::nominal == 30);
+static_assert(vtm::fpsfloat_t(vtm::fixed_timecode<vtm::fps::fps_25>::from_fields({ 1, 0, 0, 0, false })) == 36.0);
+
+namespace {
+
+template<vtm::fps::type Rate>
+void require_matches_f64timecode()
+{
+    using fixed_t = vtm::fixed_timecode<Rate>;
+    const auto fps_float = vtm::fps::to_float(Rate);
+
+    INFO("fps: " << fps_float);
+    REQUIRE(fixed_t::coefs == vtm::chrono::fps_to_ticks_by_chunk(fps_float));
+
+    for (const auto label : { "00:00:00:00", "00:00:59:23", "00:10:00:00", "10:00:00:01", "23:59:59:15" }) {
+        std::string str(label);
+        if (fixed_t::drop_frame) str[8] = ';';
+
+        const auto fixed = fixed_t::from_string(str);
+        const auto dynamic = vtm::f64timecode::from_string(str, Rate);
+
+        INFO("timecode: " << str);
+        REQUIRE(fixed.as_float() == dynamic.as_float());
+        REQUIRE(fixed.as_string() == str);
+        REQUIRE(fixed.as_string() == dynamic.as_string());
+        REQUIRE(fixed_t::from_hmsf(10, 0, 0, 1).as_float() == vtm::f64timecode::from_hmsf(10, 0, 0, 1, Rate).as_float());
+        REQUIRE(vtm::chrono::to_f64timecode(fixed) == dynamic);
+        REQUIRE(vtm::chrono::to_fixed_timecode<Rate>(dynamic) == fixed);
+    }
+}
+
+} // @END OF namespace
+
+TEST_CASE("vtm::fixed_timecode Matches f64timecode", "[timecode][chrono][fixed]")
+{
+    require_matches_f64timecode<vtm::fps::fps_24>();
+    require_matches_f64timecode<vtm::fps::fps_25>();
+    require_matches_f64timecode<vtm::fps::fps_29p97>();
+    require_matches_f64timecode<vtm::fps::fpsdf_29p97>();
+    require_matches_f64timecode<vtm::fps::fps_30>();
+    require_matches_f64timecode<vtm::fps::fps_60>();
+}
+
+TEST_CASE("vtm::fixed_timecode Arithmetic & Comparison", "[timecode][chrono][fixed]")
+{
+    using tc25 = vtm::fixed_timecode<vtm::fps::fps_25>;
+
+    const auto a = tc25::from_string("01:00:00:00");
+    const auto b = tc25::from_hmsf(0, 0, 1, 0);
+
+    REQUIRE((a + b).as_string() == "01:00:01:00");
+    REQUIRE((a - b).as_string() == "00:59:59:00");
+    REQUIRE((b - a).as_float() == 0.0);
+    REQUIRE(b < a);
+    REQUIRE(a == tc25{ 36.0 });
+    REQUIRE(tc25::fps() == vtm::fps::fps_25);
+    REQUIRE_FALSE(tc25::is_drop_frame());
+
+    REQUIRE(tc25::from_string("100:00:00:00").as_float() == 3600.0);
+    REQUIRE(fmt::format("{}", a) == "01:00:00:00");
+}
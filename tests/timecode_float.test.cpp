@@ -7,6 +7,12 @@
 #include <string>
 #include <string_view>
 
+using namespace vtm::literals;
+
+// Literal ticks are computed by the compiler
+static_assert(vtm::chrono::tcliteral_to_ticks("01:00:00:00", vtm::fpsfloat_t(25.0), false) == 36.0);
+static_assert(vtm::chrono::tcliteral_to_ticks("00:01:00;02", vtm::fpsfloat_t(29.97), true) == vtm::fpsfloat_t(1800) / vtm::fpsfloat_t(29.97) / 100.0);
+
 TEST_CASE("vtm::f64timecode Initialization", "[timecode][chrono][initialization]")
 {
     // Regular ctors
@@ -52,6 +58,21 @@ TEST_CASE("vtm::f64timecode Static Factory Functions", "[timecode][chrono][stati
 }
 
 
+TEST_CASE("vtm::f64timecode Compile-Time Literals", "[timecode][chrono][static][factory]")
+{
+    REQUIRE("01:00:00:00"_tc25 == vtm::f64timecode::from_string("01:00:00:00", vtm::fps::fps_25));
+    REQUIRE("10:20:30:12"_tc24 == vtm::f64timecode::from_string("10:20:30:12", vtm::fps::fps_24));
+    REQUIRE("00:59:59:29"_tc30 == vtm::f64timecode::from_string("00:59:59:29", vtm::fps::fps_30));
+    REQUIRE("23:59:59:59"_tc60 == vtm::f64timecode::from_string("23:59:59:59", vtm::fps::fps_60));
+    REQUIRE("01:00:00:00"_tc2997 == vtm::f64timecode::from_string("01:00:00:00", vtm::fps::fps_29p97));
+    REQUIRE("00:10:00;00"_tc2997df == vtm::f64timecode::from_string("00:10:00;00", vtm::fps::fpsdf_29p97));
+    REQUIRE("00:10:00;00"_tc2997df.as_string() == "00:10:00;00");
+
+    const auto tc = vtm::f64timecode::from_string<"01:02:03:04", vtm::fps::fps_25>();
+    REQUIRE(tc.as_string() == "01:02:03:04");
+    REQUIRE(tc.fps() == vtm::fps::fps_25);
+}
+
 TEST_CASE("vtm::f64timecode Assignment", "[timecode][chrono][operators]")
 {
     vtm::f64timecode tc_1{100.3323};
@@ -135,6 +156,37 @@ TEST_CASE("vtm::f64timecode String Representations", "[timecode][chrono][string]
     REQUIRE(tc_4.as_string() == "01:00:00:00");
 }
 
+TEST_CASE("vtm::f64timecode Allocation-Free Formatting", "[timecode][chrono][string][conversion]")
+{
+    const vtm::f64timecode tc_1{36.0};
+    const vtm::f64timecode tc_2 = vtm::f64timecode::from_string("10:59:59:24", vtm::fps::fps_25);
+    const vtm::f64timecode tc_3 = vtm::f64timecode::from_string("00:00:59:23", vtm::fps::fps_24);
+
+    char buffer[16] = {};
+    REQUIRE(tc_1.format_to(buffer) == buffer + 11);
+    REQUIRE(std::string_view(buffer, 11) == "01:00:00:00");
+
+    tc_2.format_to(buffer);
+    REQUIRE(std::string_view(buffer, 11) == "10:59:59:24");
+
+    tc_3.format_to(buffer);
+    REQUIRE(std::string_view(buffer, 11) == "00:00:59:23");
+
+    const auto [ptr_ok, ec_ok] = tc_2.to_chars(buffer, buffer + 16);
+    REQUIRE(ec_ok == std::errc{});
+    REQUIRE(ptr_ok == buffer + 11);
+
+    const auto [ptr_small, ec_small] = tc_2.to_chars(buffer, buffer + 10);
+    REQUIRE(ec_small == std::errc::value_too_large);
+
+    // Frames that round up carry into the next second
+    const vtm::f64timecode tc_4{0.01 - 0.0001 / 24.0, vtm::fps::fps_24};
+    REQUIRE(tc_4.as_string() == "00:00:01:00");
+
+    REQUIRE(fmt::format("{}", tc_1) == "01:00:00:00");
+    REQUIRE(fmt::format("{} - {}", tc_1, tc_2) == "01:00:00:00 - 10:59:59:24");
+}
+
 TEST_CASE("vtm::f64timecode Structured Binding", "[timecode][chrono][structuredbinding][tuple][pair]")
 {
     const vtm::f64timecode tc_1{36.0};
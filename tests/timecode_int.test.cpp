@@ -3,11 +3,96 @@
 #include "catch2/catch_message.hpp"
 #include "catch2/catch_test_macros.hpp"
 #include "timecode.hpp"
+#include <cstdint>
+#include <random>
 #include <string>
 #include <string_view>
 
 TEST_CASE("vtm::timecode Initialization", "[timecode][chrono][initialization]")
 {
     vtm::timecode tc1{};
-    REQUIRE(1 == 1);
+    REQUIRE(tc1.as_string() == "00:00:00:00");
+    REQUIRE(tc1.digits() == 0);
+
+    const vtm::timecode tc2{std::string_view("01:02:03:04")};
+    REQUIRE(tc2.as_string() == "01:02:03:04");
+    REQUIRE(tc2.digits() == 0x0001000200030004ull);
+
+    const auto tc3 = vtm::timecode::from_hmsf(10, 20, 30, 12, vtm::fps::fps_24);
+    REQUIRE(tc3.as_string() == "10:20:30:12");
+    REQUIRE(tc3.frames() == ((10 * 60 + 20) * 60 + 30) * 24 + 12);
+
+    const vtm::timecode tc4{90000, vtm::fps::fps_25};
+    REQUIRE(tc4.as_string() == "01:00:00:00");
+    REQUIRE(tc4.as_signed() == 90000);
+    REQUIRE(tc4.as_float() == 36.0);
+
+    const vtm::timecode tc5{vtm::fpsfloat_t(36.0), vtm::fps::fps_30};
+    REQUIRE(tc5.as_string() == "01:00:00:00");
+
+    const auto tc6 = vtm::timecode::from_string("01:00:00;00", vtm::fps::fpsdf_29p97);
+    REQUIRE(tc6.as_string() == "01:00:00;00");
+    REQUIRE(tc6.frames() == 107892);
+    REQUIRE(tc6.is_drop_frame());
+    const std::string label = tc6.display();
+    REQUIRE(label == "01:00:00;00");
+    REQUIRE(tc3.display() == tc3.as_string());
+
+    tc1 = tc3;
+    tc1.reset();
+    REQUIRE(tc1.as_string() == "00:00:00:00");
+}
+
+TEST_CASE("vtm::timecode Matches f64timecode", "[timecode][chrono][conversion]")
+{
+    for (const auto fps : { vtm::fps::fps_24, vtm::fps::fps_25, vtm::fps::fps_29p97, vtm::fps::fps_30, vtm::fps::fps_60 }) {
+        for (const auto label : { "00:00:00:00", "00:00:59:23", "10:00:00:01", "23:59:59:15" }) {
+            INFO("fps: " << vtm::fps::to_float(fps) << " timecode: " << label);
+            const auto tc = vtm::timecode::from_string(label, fps);
+            const auto f64 = vtm::f64timecode::from_string(label, fps);
+            REQUIRE(tc.as_float() == f64.as_float());
+            REQUIRE(vtm::timecode{f64.as_float(), fps}.as_string() == label);
+        }
+    }
+}
+
+TEST_CASE("vtm::timecode SWAR Arithmetic", "[timecode][chrono][arithmetic]")
+{
+    const auto tc = [](std::string_view s, vtm::fps::type fps = vtm::fps::fps_25) { return vtm::timecode::from_string(s, fps); };
+
+    REQUIRE((tc("00:00:00:24") + tc("00:00:00:01")).as_string() == "00:00:01:00");
+    REQUIRE((tc("00:59:59:24") + tc("00:00:00:01")).as_string() == "01:00:00:00");
+    REQUIRE((tc("09:59:59:24") + tc("00:00:00:01")).as_string() == "10:00:00:00");
+    REQUIRE((tc("99:59:59:24") + tc("00:00:00:01")).as_string() == "00:00:00:00");
+    REQUIRE((tc("01:00:00:00") - tc("00:00:00:01")).as_string() == "00:59:59:24");
+    REQUIRE((tc("00:00:00:01") - tc("00:00:00:02")).as_string() == "00:00:00:00");
+    REQUIRE((tc("00:00:00:59", vtm::fps::fps_60) + tc("00:00:00:59", vtm::fps::fps_60)).as_string() == "00:00:01:58");
+    REQUIRE((tc("00:01:00;02", vtm::fps::fpsdf_29p97) - tc("00:00:00;01", vtm::fps::fpsdf_29p97)).as_string() == "00:00:59;29");
+    REQUIRE((tc("00:09:59;29", vtm::fps::fpsdf_29p97) + tc("00:00:00;01", vtm::fps::fpsdf_29p97)).as_string() == "00:10:00;00");
+
+    REQUIRE(tc("00:00:01:00") < tc("00:00:01:01"));
+    REQUIRE(tc("10:00:00:00") > tc("09:59:59:24"));
+    REQUIRE_FALSE(tc("00:00:01:00", vtm::fps::fps_24) < tc("00:00:01:01"));
+
+    // Packed arithmetic agrees with plain frame counting
+    std::mt19937_64 rng(42);
+    for (const auto fps : { vtm::fps::fps_24, vtm::fps::fps_25, vtm::fps::fps_29p97, vtm::fps::fps_30, vtm::fps::fps_60 }) {
+        const std::uint64_t day = 24ull * 3600 * vtm::fps::to_rational(fps).nominal();
+        std::uniform_int_distribution<std::uint64_t> dist(0, day);
+
+        std::uint64_t mismatches = 0;
+        for (int i = 0; i < 10000; ++i) {
+            const std::uint64_t a = dist(rng);
+            const std::uint64_t b = dist(rng);
+            const vtm::timecode ta{a, fps};
+            const vtm::timecode tb{b, fps};
+
+            mismatches += (ta + tb).frames() != a + b;
+            mismatches += (ta - tb).frames() != (a > b ? a - b : 0);
+            mismatches += (ta < tb) != (a < b);
+        }
+
+        INFO("fps: " << vtm::fps::to_float(fps));
+        REQUIRE(mismatches == 0);
+    }
 }
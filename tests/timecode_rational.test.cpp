@@ -0,0 +1,84 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "catch2/catch_message.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "timecode.hpp"
+#include <string>
+
+TEST_CASE("vtm::r64timecode Construction", "[timecode][chrono][rational]")
+{
+    const auto tc = vtm::r64timecode::from_string("01:00:00:00", vtm::fps::fps_25);
+    REQUIRE(tc.frames() == 90000);
+    REQUIRE(tc.subframes() == 90000 * 100);
+    REQUIRE(tc.as_string() == "01:00:00:00");
+    REQUIRE(tc.as_float() == 36.0);
+
+    const auto ndf = vtm::r64timecode::from_hmsf(1, 0, 0, 0, vtm::fps::fps_29p97);
+    REQUIRE(ndf.frames() == 108000);
+    REQUIRE(ndf.rate() == vtm::chrono::internal::__FPSRational<vtm::fpsint_t>{ 30000, 1001 });
+    REQUIRE(ndf.seconds() == Catch::Approx(3603.6));
+    REQUIRE(ndf.as_string() == "01:00:00:00");
+
+    REQUIRE(vtm::r64timecode::from_frames(24, 0, vtm::fps::fps_24).as_string() == "00:00:01:00");
+    REQUIRE(vtm::r64timecode::from_frames(23, 99, vtm::fps::fps_24).as_string() == "00:00:00:23");
+}
+
+TEST_CASE("vtm::r64timecode Exact Accumulation", "[timecode][chrono][rational]")
+{
+    // One frame at a time over a full 24 hour 29.97 timeline lands exactly on the end
+    auto tc = vtm::r64timecode::from_frames(0, 0, vtm::fps::fps_29p97);
+    const auto frames = 24 * 3600 * 30;
+    for (int i = 0; i < frames; ++i) tc += vtm::r64timecode::from_frames(1, 0, vtm::fps::fps_29p97);
+
+    REQUIRE(tc == vtm::r64timecode::from_string("24:00:00:00", vtm::fps::fps_29p97));
+    REQUIRE(tc.as_string() == "24:00:00:00");
+
+    for (int i = 0; i < frames; ++i) tc -= 100;
+    REQUIRE(tc.subframes() == 0);
+    REQUIRE((tc - 1).subframes() == 0);
+}
+
+TEST_CASE("vtm::r64timecode Cross-Rate Comparison", "[timecode][chrono][rational]")
+{
+    const auto a = vtm::r64timecode::from_string("00:00:01:00", vtm::fps::fps_24);
+    const auto b = vtm::r64timecode::from_string("00:00:01:00", vtm::fps::fps_25);
+    const auto c = vtm::r64timecode::from_string("00:00:02:00", vtm::fps::fps_30);
+    const auto d = vtm::r64timecode::from_string("00:00:01:00", vtm::fps::fps_29p97);
+
+    REQUIRE(a != b);
+    REQUIRE(a < b);
+    REQUIRE(b < a + b);
+    REQUIRE(a < c);
+    REQUIRE(d > b);
+
+    REQUIRE(a.to_fps(vtm::fps::fps_60).frames() == 60);
+    REQUIRE(c.to_fps(vtm::fps::fps_24).as_string() == "00:00:02:00");
+    REQUIRE(d.to_fps(vtm::fps::fps_30).subframes() == 3003);
+
+    // About 1000 days at 119.88 fps, past where unreduced cross products overflow
+    const auto long_run = vtm::r64timecode::from_frames(vtm::fpsint_t(120000) * 86400, 0, vtm::fps::fps_119p88);
+    const auto slower = long_run.to_fps(vtm::fps::fps_23p976);
+    REQUIRE(slower.subframes() == long_run.subframes() / 5);
+    REQUIRE(slower.to_fps(vtm::fps::fps_119p88) == long_run);
+    REQUIRE(slower - 1 < long_run);
+    REQUIRE(long_run - 1 < slower);
+    REQUIRE(long_run.to_fps(vtm::fps::fps_120).to_fps(vtm::fps::fps_119p88) == long_run);
+}
+
+TEST_CASE("vtm::r64timecode Floating Point Conversion", "[timecode][chrono][rational]")
+{
+    for (const auto fps : { vtm::fps::fps_24, vtm::fps::fps_25, vtm::fps::fps_29p97, vtm::fps::fps_30, vtm::fps::fps_60 }) {
+        for (const auto& str : { "00:00:00:00", "00:59:59:23", "10:00:00:01", "23:59:59:15" }) {
+            const auto f = vtm::f64timecode::from_string(str, fps);
+            const auto r = vtm::chrono::to_r64timecode(f);
+
+            INFO("fps: " << vtm::fps::to_float(fps) << " timecode: " << str);
+            REQUIRE(r.as_string() == str);
+            REQUIRE(r == vtm::r64timecode::from_string(str, fps));
+            REQUIRE(vtm::chrono::to_f64timecode(r).as_string() == str);
+            REQUIRE(vtm::chrono::to_f64timecode(r).as_float() == Catch::Approx(f.as_float()));
+        }
+    }
+
+    REQUIRE(fmt::format("{}", vtm::r64timecode::from_hmsf(1, 2, 3, 4, vtm::fps::fps_25)) == "01:02:03:04");
+}
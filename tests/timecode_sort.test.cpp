@@ -0,0 +1,110 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "catch2/catch_message.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "timecode.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+TEST_CASE("vtm::chrono::ordering_key Absolute Time", "[timecode][chrono][sort]")
+{
+    using vtm::chrono::ordering_key;
+
+    // One second at every rate is the same instant
+    const auto second = ordering_key(vtm::f64timecode::from_string("00:00:01:00", vtm::fps::fps_25));
+    REQUIRE(second == VTM_TIMECODE_FLICKS_PER_SECOND);
+    REQUIRE(ordering_key(vtm::f64timecode::from_string("00:00:01:00", vtm::fps::fps_24)) == second);
+    REQUIRE(ordering_key(vtm::f64timecode::from_string("00:00:01:00", vtm::fps::fps_60)) == second);
+    REQUIRE(ordering_key(vtm::dense_timecode::from_string("00:00:01:00", vtm::fps::fps_30)) == second);
+
+    // Frames of different rates interleave where operator<=> cannot order them
+    const auto f24 = vtm::f64timecode::from_string("00:00:00:12", vtm::fps::fps_24);
+    const auto f25 = vtm::f64timecode::from_string("00:00:00:12", vtm::fps::fps_25);
+    REQUIRE_FALSE(f25 < f24);
+    REQUIRE(ordering_key(f25) < ordering_key(f24));
+
+    // Rational frames land exactly on flicks, 1001/30000 s = 23543520 flicks
+    const auto r = vtm::r64timecode::from_frames(30, 0, vtm::fps::fps_29p97);
+    REQUIRE(ordering_key(r) == 30 * 23543520ull);
+    REQUIRE(ordering_key(vtm::r64timecode::from_frames(24, 0, vtm::fps::fps_24)) == second);
+
+    // Fractional non-drop labels run slow, f64 keys agree with r64 ones
+    const auto label_2997 = vtm::f64timecode::from_string("01:00:00:00", vtm::fps::fps_29p97);
+    const auto later_30 = vtm::f64timecode::from_string("01:00:02:00", vtm::fps::fps_30);
+    REQUIRE(ordering_key(label_2997) == 36036 * (VTM_TIMECODE_FLICKS_PER_SECOND / 10ull));
+    REQUIRE(ordering_key(label_2997) == ordering_key(vtm::r64timecode::from_string("01:00:00:00", vtm::fps::fps_29p97)));
+    REQUIRE(ordering_key(label_2997) > ordering_key(later_30));
+    REQUIRE(ordering_key(later_30) == ordering_key(vtm::r64timecode::from_string("01:00:02:00", vtm::fps::fps_30)));
+    for (const auto fps : { vtm::fps::fps_23p976, vtm::fps::fps_29p97, vtm::fps::fpsdf_29p97, vtm::fps::fps_59p94, vtm::fps::fpsdf_59p94 }) {
+        for (const std::string_view label : { "00:00:00:01", "00:59:59:23", "01:00:00:00", "10:00:00:12", "23:59:59:23" }) {
+            INFO(vtm::fps::to_string(fps) << " " << label);
+            REQUIRE(ordering_key(vtm::f64timecode::from_string(label, fps)) == ordering_key(vtm::r64timecode::from_string(label, fps)));
+        }
+    }
+
+    REQUIRE(ordering_key(-1.0) == 0);
+    REQUIRE(ordering_key(std::numeric_limits<double>::quiet_NaN()) == 0);
+}
+
+TEST_CASE("vtm::chrono::radix_sort Stable Pairs", "[timecode][chrono][sort]")
+{
+    std::mt19937_64 rng(3);
+
+    // Narrow keys with shared trailing zeros, then keys spanning all 64 bits
+    for (const int shift : { 24, 0 }) {
+        std::vector<vtm::chrono::tcorder_key_t> keys(5000);
+        std::vector<std::uint32_t> payload(keys.size());
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            keys[i] = shift ? (rng() % (1ull << 20)) << shift : rng();
+            payload[i] = static_cast<std::uint32_t>(i);
+        }
+        keys[1] = keys[0];
+
+        std::vector<std::pair<vtm::chrono::tcorder_key_t, std::uint32_t>> expected;
+        for (std::size_t i = 0; i < keys.size(); ++i) expected.emplace_back(keys[i], payload[i]);
+        std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        vtm::chrono::radix_sort(std::span(keys), std::span(payload));
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            INFO("shift: " << shift << " index: " << i);
+            REQUIRE(keys[i] == expected[i].first);
+            REQUIRE(payload[i] == expected[i].second);
+        }
+    }
+}
+
+TEST_CASE("vtm::chrono::sort_timecodes Mixed Frame Rates", "[timecode][chrono][sort]")
+{
+    std::mt19937_64 rng(11);
+    std::uniform_int_distribution<int> frames(0, 24 * 3600 * 24);
+    const vtm::fps::type rates[] = { vtm::fps::fps_24, vtm::fps::fps_25, vtm::fps::fps_30, vtm::fps::fps_60, vtm::fps::fps_29p97, vtm::fps::fps_23p976 };
+
+    std::vector<vtm::f64timecode> tcs;
+    for (int i = 0; i < 2000; ++i) {
+        const auto fps = rates[i % 6];
+        tcs.emplace_back(vtm::fpsfloat_t(frames(rng)) / (vtm::fps::to_float(fps) * 100.0), fps);
+    }
+    // Duplicates of the same instant at another rate keep their input order
+    tcs.emplace_back(vtm::fpsfloat_t(0.01), vtm::fps::fps_24);
+    tcs.emplace_back(vtm::fpsfloat_t(0.01), vtm::fps::fps_25);
+
+    const auto order = vtm::chrono::sorted_order(std::span<const vtm::f64timecode>(tcs));
+    for (std::size_t i = 1; i < order.size(); ++i) {
+        const auto prev = vtm::chrono::ordering_key(tcs[order[i - 1]]);
+        const auto curr = vtm::chrono::ordering_key(tcs[order[i]]);
+        REQUIRE(prev <= curr);
+        if (prev == curr) REQUIRE(order[i - 1] < order[i]);
+    }
+
+    vtm::chrono::sort_timecodes(std::span(tcs));
+    REQUIRE(std::is_sorted(tcs.begin(), tcs.end(), [](const auto& a, const auto& b) {
+        return vtm::chrono::ordering_key(a) < vtm::chrono::ordering_key(b);
+    }));
+
+    vtm::timecode_column column{ vtm::fps::fps_25 };
+    for (int i = 0; i < 1000; ++i) column.push_back(vtm::fpsfloat_t(frames(rng)) / 2500.0);
+    vtm::chrono::sort_timecodes(column);
+    REQUIRE(std::is_sorted(column.values().begin(), column.values().end()));
+}
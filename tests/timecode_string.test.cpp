@@ -0,0 +1,96 @@
+#define CATCH_CONFIG_MAIN
+#include <Catch2/catch_all.hpp>
+#include "catch2/catch_message.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "timecode.hpp"
+#include <array>
+#include <string>
+#include <string_view>
+
+TEST_CASE("vtm::chrono Fixed-Width Timecode Parsing", "[timecode][chrono][string][parsing]")
+{
+    using namespace vtm::chrono;
+
+    const std::array<std::string_view, 6> good{
+        "00:00:00:00", "01:02:03:04", "23:59:59:29", "99:99:99:99", "10:00:00;02", "10;00;00;02"
+    };
+
+    for (const auto& tc : good) {
+        tcstring_fields scalar, swar, fast;
+        INFO("timecode string: " << tc);
+        REQUIRE(internal::parse_tcstring_fixed_scalar(tc.data(), scalar));
+        REQUIRE(internal::parse_tcstring_fixed_swar(tc.data(), swar));
+        REQUIRE(parse_tcstring_fixed(tc, fast));
+
+        REQUIRE(scalar.hours == swar.hours);     REQUIRE(scalar.hours == fast.hours);
+        REQUIRE(scalar.minutes == swar.minutes); REQUIRE(scalar.minutes == fast.minutes);
+        REQUIRE(scalar.seconds == swar.seconds); REQUIRE(scalar.seconds == fast.seconds);
+        REQUIRE(scalar.frames == swar.frames);   REQUIRE(scalar.frames == fast.frames);
+        REQUIRE(scalar.drop_frame == swar.drop_frame);
+        REQUIRE(scalar.drop_frame == fast.drop_frame);
+    }
+
+    tcstring_fields fields;
+    REQUIRE(parse_tcstring_fixed(std::string_view("01:02:03:04"), fields));
+    REQUIRE(fields.hours == 1); REQUIRE(fields.minutes == 2);
+    REQUIRE(fields.seconds == 3); REQUIRE(fields.frames == 4);
+    REQUIRE_FALSE(fields.drop_frame);
+
+    REQUIRE(parse_tcstring_fixed(std::string_view("10:00:00;02"), fields));
+    REQUIRE(fields.drop_frame);
+
+    const std::array<std::string_view, 9> bad{
+        "0a:00:00:00", "00:00:00:0/", "00-00:00:00", "00:00:00.00", "00;00:00:00",
+        "00:00:00:000", "0:00:00:00", "00 00 00 00", "0000:00:000"
+    };
+
+    for (const auto& tc : bad) {
+        INFO("timecode string: " << tc);
+        if (tc.size() == VTM_TCSTRING_FIXED_SIZE) {
+            REQUIRE_FALSE(internal::parse_tcstring_fixed_scalar(tc.data(), fields));
+            REQUIRE_FALSE(internal::parse_tcstring_fixed_swar(tc.data(), fields));
+        }
+        REQUIRE_FALSE(parse_tcstring_fixed(tc, fields));
+    }
+}
+
+#if defined(VTM_TIMECODE_SIMD_AVX2)
+TEST_CASE("vtm::chrono Fixed-Width Timecode Parsing AVX2", "[timecode][chrono][string][parsing][simd]")
+{
+    using namespace vtm::chrono;
+    tcstring_fields a, b;
+
+    REQUIRE(internal::parse_tcstring_fixed_avx2("01:02:03:04", "10:20:30;12", a, b) == 0b11);
+    REQUIRE(a.hours == 1);   REQUIRE(a.frames == 4);  REQUIRE_FALSE(a.drop_frame);
+    REQUIRE(b.minutes == 20); REQUIRE(b.seconds == 30); REQUIRE(b.drop_frame);
+
+    REQUIRE(internal::parse_tcstring_fixed_avx2("01:02:03:04", "10;20:30:12", a, b) == 0b01);
+    REQUIRE(internal::parse_tcstring_fixed_avx2("x1:02:03:04", "10:20:30:12", a, b) == 0b10);
+}
+#endif
+
+TEST_CASE("vtm::chrono Fixed-Width Timecode Ticks", "[timecode][chrono][string][conversion]")
+{
+    using namespace vtm::chrono;
+
+    // The fixed-width path must produce the same ticks as summing each chunk by its coefficient
+    for (const auto fps : { 24.0L, 25.0L, 29.97L, 30.0L, 60.0L }) {
+        const auto coefs = fps_to_ticks_by_chunk(fps);
+        vtm::fpsfloat_t expected = 0.0;
+        expected += 1.0L * coefs[0];
+        expected += 2.0L * coefs[1];
+        expected += 3.0L * coefs[2];
+        expected += 4.0L * coefs[3];
+
+        INFO("fps: " << fps);
+        REQUIRE(tcstring_to_ticks(std::string_view("01:02:03:04"), fps) == expected);
+        REQUIRE(tcstring_to_ticks(std::string("01:02:03:04"), fps) == expected);
+    }
+
+    REQUIRE(valid_tcstring(std::string_view("01:02:03:04")));
+    REQUIRE(valid_tcstring(std::string_view("100:02:03:04")));
+    REQUIRE_FALSE(valid_tcstring(std::string_view("01:02:03:0x")));
+
+    const auto tc = vtm::f64timecode::from_string("01:00:00:00", vtm::fps::fps_25);
+    REQUIRE(tc.as_float() == 36.0);
+}